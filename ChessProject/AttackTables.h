@@ -0,0 +1,194 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This file holds the tiles attacked by the leaping pieces, the knight, king and pawn, from each of the 64 squares. Each square's targets are kept both as a list of
+board positions, with the border tiles already left out, and as a bit per square. The tables are generated at compile time from the board's TileVectors, so finding
+a leaper's targets is one table read, with nothing to build at startup. The directions the scanning pieces move in are kept here too, by piece type.
+
+For the scanning pieces, the line through any two squares and the squares between them are also kept as bits, so whether two squares are aligned, what lies
+between them, and so pins, the tiles that block a check and a castling king's path, are a table read and a mask against the board's occupancy.
+*/
+
+#ifndef __ATTACKTABLES_HEADER
+#define __ATTACKTABLES_HEADER
+
+#include <array>
+#include <cstdint>
+
+#include "BoardBase.h"
+#include "Tile.h"
+
+namespace Chess {
+
+	//the targets of a leaper on one square.
+	struct LeaperTargets
+	{
+		//board positions, in the order of the vectors they were generated from.
+		std::uint8_t m_positions[8]{};
+		int m_count{ 0 };
+		//bit n is set if square n is a target, a8 is bit 0.
+		std::uint64_t m_mask{ 0 };
+
+		constexpr const std::uint8_t* begin() const { return m_positions; }
+		constexpr const std::uint8_t* end() const { return m_positions + m_count; }
+
+		inline constexpr const bool contains_square(const int square) const { return ((m_mask >> square) & 1) != 0; }
+	};
+
+	struct LeaperAttacks
+	{
+		//indexed by square, 0 (a8) to 63 (h1).
+		LeaperTargets m_knight[64]{};
+		LeaperTargets m_king[64]{};
+		//indexed by white (0) or black (1), then square. a pawn attacks the two tiles diagonally forward.
+		LeaperTargets m_pawn[2][64]{};
+	};
+
+	constexpr LeaperTargets generate_leaper_targets(const int square, const int* vectors, const int vector_count)
+	{
+		using Squares = BoardBase<10, 12, Tile>::Squares;
+
+		LeaperTargets targets{};
+		const int position{ Squares::positions[square] };
+
+		for (int i{ 0 }; i < vector_count; ++i) {
+
+			const int target_square{ Squares::squares[position + vectors[i]] };
+
+			//a jump off the visible board lands on the border.
+			if (target_square < 0)
+				continue;
+
+			targets.m_positions[targets.m_count++] = static_cast<std::uint8_t>(position + vectors[i]);
+			targets.m_mask |= std::uint64_t(1) << target_square;
+		}
+
+		return targets;
+	}
+
+	constexpr LeaperAttacks generate_leaper_attacks()
+	{
+		using TileVector = BoardBase<10, 12, Tile>::TileVector;
+
+		//in ascending order, as the scanning pieces' vectors are.
+		constexpr int knight_vectors[] = { TileVector::north_north_west, TileVector::north_north_east, TileVector::north_west_west, TileVector::north_east_east,
+			TileVector::south_west_west, TileVector::south_east_east, TileVector::south_south_west, TileVector::south_south_east };
+
+		constexpr int king_vectors[] = { TileVector::north_west, TileVector::north, TileVector::north_east, TileVector::west,
+			TileVector::east, TileVector::south_west, TileVector::south, TileVector::south_east };
+
+		constexpr int white_pawn_vectors[] = { TileVector::north_west, TileVector::north_east };
+		constexpr int black_pawn_vectors[] = { TileVector::south_west, TileVector::south_east };
+
+		LeaperAttacks attacks{};
+
+		for (int square{ 0 }; square < 64; ++square) {
+
+			attacks.m_knight[square] = generate_leaper_targets(square, knight_vectors, 8);
+			attacks.m_king[square] = generate_leaper_targets(square, king_vectors, 8);
+			attacks.m_pawn[0][square] = generate_leaper_targets(square, white_pawn_vectors, 2);
+			attacks.m_pawn[1][square] = generate_leaper_targets(square, black_pawn_vectors, 2);
+		}
+
+		return attacks;
+	}
+
+	inline constexpr LeaperAttacks leaper_attacks{ generate_leaper_attacks() };
+
+	//the directions a scanning piece moves in, until it is blocked.
+	struct ScanningVectors
+	{
+		int m_vectors[8]{};
+		int m_count{ 0 };
+
+		constexpr const int* begin() const { return m_vectors; }
+		constexpr const int* end() const { return m_vectors + m_count; }
+	};
+
+	constexpr std::array<ScanningVectors, 8> generate_scanning_vectors()
+	{
+		using TileVector = BoardBase<10, 12, Tile>::TileVector;
+
+		std::array<ScanningVectors, 8> vectors{};
+
+		vectors[static_cast<int>(TileType::Bishop)] = { { TileVector::north_west, TileVector::north_east, TileVector::south_west, TileVector::south_east }, 4 };
+		vectors[static_cast<int>(TileType::Rook)] = { { TileVector::north, TileVector::west, TileVector::east, TileVector::south }, 4 };
+		vectors[static_cast<int>(TileType::Queen)] = { { TileVector::north_west, TileVector::north, TileVector::north_east, TileVector::west,
+			TileVector::east, TileVector::south_west, TileVector::south, TileVector::south_east }, 8 };
+
+		return vectors;
+	}
+
+	//indexed by TileType, only the bishop, rook and queen have any.
+	inline constexpr std::array<ScanningVectors, 8> scanning_vectors{ generate_scanning_vectors() };
+
+	//indexed by square then square, each is a bit per square, a8 is bit 0.
+	struct LineTables
+	{
+		//every square of the line through both squares, from edge to edge, or 0 if they aren't on a rank, file or diagonal together.
+		std::uint64_t m_line[64][64]{};
+		//the squares strictly between the two, 0 if they aren't on a line or are next to each other.
+		std::uint64_t m_between[64][64]{};
+	};
+
+	constexpr LineTables generate_line_tables()
+	{
+		using Squares = BoardBase<10, 12, Tile>::Squares;
+
+		LineTables tables{};
+
+		for (int square{ 0 }; square < 64; ++square) {
+
+			const int position{ Squares::positions[square] };
+
+			for (const int vector : scanning_vectors[static_cast<int>(TileType::Queen)]) {
+
+				//the line is the same whichever way along it the other square is, so walk both ways to the border first.
+				std::uint64_t line{ std::uint64_t(1) << square };
+
+				for (const int direction : { vector, -vector })
+					for (int destination{ position + direction }; Squares::squares[destination] >= 0; destination += direction)
+						line |= std::uint64_t(1) << Squares::squares[destination];
+
+				std::uint64_t between{ 0 };
+
+				for (int destination{ position + vector }; Squares::squares[destination] >= 0; destination += vector) {
+
+					const int target{ Squares::squares[destination] };
+
+					tables.m_line[square][target] = line;
+					tables.m_between[square][target] = between;
+
+					between |= std::uint64_t(1) << target;
+				}
+			}
+		}
+
+		return tables;
+	}
+
+	inline constexpr LineTables line_tables{ generate_line_tables() };
+
+	//do the two squares share a diagonal rather than a rank or file? only meaningful if they are on a line.
+	inline constexpr const bool is_diagonal(const int square, const int other_square) { return ((square / 8) != (other_square / 8)) && ((square % 8) != (other_square % 8)); }
+
+	//could a scanning piece of the type on the square reach the target, if nothing stood between them?
+	inline constexpr const bool is_aligned(const TileType type, const int square, const int target)
+	{
+		return (line_tables.m_line[square][target] != 0) && ((type == TileType::Queen) || ((type == TileType::Bishop) == is_diagonal(square, target)));
+	}
+
+	//the lowest square of a non-empty mask, by de Bruijn multiplication.
+	inline constexpr const int get_lowest_square(const std::uint64_t mask)
+	{
+		constexpr int de_bruijn_squares[64] = { 0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4, 62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+			63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6 };
+
+		return de_bruijn_squares[((mask & (~mask + 1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+	}
+}
+
+#endif
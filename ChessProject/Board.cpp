@@ -1,18 +1,16 @@
-//satisfy forward declaration first.
-#include "Piece.h"
-
+#include "AttackTables.h"
 #include "Board.h"
+#include "FactionTraits.h"
+#include "MoveGenerator.h"
+#include "Zobrist.h"
 
 #include <cassert>
 #include <string>
 #include <sstream>
+#include <cctype>
+#include <cstdlib>
 
-//attack logic
-#include "ScanningPiece.h"
-#include "King.h"
-#include "Pawn.h"
-
-Chess::Board::Board(const FEN& fen_notation) : m_player(std::make_shared<Player>("White", Faction::White)), m_enemy(std::make_shared<Player>("Black", Faction::Black))
+Chess::Board::Board(const FEN& fen_notation) : m_player(std::make_shared<Player>("White", Faction::White)), m_enemy(std::make_shared<Player>("Black", Faction::Black)), m_states(initial_states)
 {
 	//begin parsing the fen_notation.
 	//firstly make the board,
@@ -25,22 +23,11 @@ Chess::Board::Board(const FEN& fen_notation) : m_player(std::make_shared<Player>
 		throw std::logic_error("Logic Error: Invalid board configuration.");
 	}
 
-	//using FEN notation may require a conversion from chess position to int or coordinate position, generate a map using the board we just made.
-	m_conversion_table = generate_conversion_table();
+	generate_piece_lists();
 
 	//parse the castling rights
 	fen_notation.get_castling_rights();
 
-	//parse the enpassant
-	std::string enpassant_coordinate = fen_notation.get_enpassant_position();
-
-	auto enpassant_position = convert_coordinate_to_position(enpassant_coordinate);
-	
-	if (enpassant_position.first)
-		m_enpassant_position = enpassant_position.second;
-	else
-		m_enpassant_position = 0;
-
 	//parse clocks
 	m_half_move_clock = std::stoi(fen_notation.get_half_move_clock());
 	m_full_move_clock = std::stoi(fen_notation.get_full_move_clock());
@@ -71,29 +58,110 @@ Chess::Board::Board(const FEN& fen_notation) : m_player(std::make_shared<Player>
 		}
 	}
 
-	//determine the order of the order of the player.
-	if (fen_notation.get_player_to_play() == "w") {
+	//determine the order of the order of the player, m_player is always the player to move.
+	if (fen_notation.get_player_to_play() == "b") {
+
+		std::swap(m_player, m_enemy);
+	}
+
+	//parse the enpassant, FEN gives the tile skipped by the double push whereas the board tracks the pawn which may be captured.
+	std::string enpassant_coordinate = fen_notation.get_enpassant_position();
+
+	auto enpassant_position = convert_coordinate_to_position(enpassant_coordinate);
+	
+	if (enpassant_position.first)
+		m_enpassant_position = enpassant_position.second + ((m_player->get_faction() == Faction::White) ? TileVector::south : TileVector::north);
+	else
+		m_enpassant_position = 0;
+
+	m_hash = compute_hash();
+}
+
+Chess::Board::Board(const PackedPosition& packed_position) : m_player(std::make_shared<Player>("White", Faction::White)), m_enemy(std::make_shared<Player>("Black", Faction::Black)), m_states(initial_states)
+{
+	//start from a board of border tiles, then fill in the visible board square by square.
+	m_board.assign(m_board_x * m_board_y, Tile(TileType::Border, Faction::NonAligned));
+
+	const std::uint64_t occupancy{ packed_position.get_occupancy() };
+	int piece_index{ 0 };
+
+	for (int square{ 0 }; square < static_cast<int>(m_game_board_x * m_game_board_y); ++square) {
+
+		const int position{ convert_square_to_position(square) };
+
+		if ((occupancy & (std::uint64_t(1) << square)) == 0) {
+
+			m_board[position].clear();
+			continue;
+		}
+
+		if (piece_index == PackedPosition::max_pieces)
+			throw std::logic_error("Logic Error: Invalid packed position, too many pieces.");
+
+		const int code{ packed_position.get_piece_code(piece_index++) };
+		const int tile_type{ code & 7 };
+
+		if (tile_type < static_cast<int>(TileType::Pawn) || tile_type > static_cast<int>(TileType::King))
+			throw std::logic_error("Logic Error: Invalid packed position, unknown piece code.");
+
+		m_board[position] = Tile(static_cast<TileType>(tile_type), ((code & 8) != 0) ? Faction::Black : Faction::White);
+	}
+
+	if (!is_board_valid()) {
+
+		throw std::logic_error("Logic Error: Invalid board configuration.");
+	}
+
+	generate_piece_lists();
 
+	set_castle_permissions(packed_position.get_castle_permissions());
+
+	//m_player is always the player to move.
+	if (packed_position.is_black_to_play())
 		std::swap(m_player, m_enemy);
+
+	//the packed enpassant square is the tile skipped by the double push, the board tracks the pawn which may be captured.
+	const int enpassant_square{ packed_position.get_enpassant_square() };
+
+	if (enpassant_square != PackedPosition::no_enpassant) {
+
+		//the skipped tile is on the 6th rank if black double pushed, the 3rd if white did.
+		const int enpassant_row{ (m_player->get_faction() == Faction::White) ? 2 : Squares::game_board_y - 3 };
+
+		if (enpassant_square >= Squares::count || (enpassant_square / Squares::game_board_x) != enpassant_row)
+			throw std::logic_error("Logic Error: Invalid packed position, impossible enpassant square.");
+
+		m_enpassant_position = convert_square_to_position(enpassant_square) + ((m_player->get_faction() == Faction::White) ? TileVector::south : TileVector::north);
 	}
+	else {
+
+		m_enpassant_position = 0;
+	}
+
+	m_half_move_clock = packed_position.get_half_move_clock();
+	m_full_move_clock = packed_position.get_full_move_clock();
+
+	m_hash = compute_hash();
 }
 
 Chess::Board::Board(Board&& board) noexcept
 {
 	m_player = std::move(board.m_player);
 	m_enemy = std::move(board.m_enemy);
-	m_pieces = std::move(board.m_pieces);
-	m_captured_pieces = std::move(board.m_captured_pieces);
+	m_pieces = board.m_pieces;
+	m_pin_rays = board.m_pin_rays;
 	m_board = std::move(board.m_board);
-	m_captured_tiles = std::move(board.m_captured_tiles);
 	m_moves = std::move(board.m_moves);
-	m_move_history = std::move(board.m_move_history);
-	m_conversion_table = std::move(board.m_conversion_table);
+	m_states = std::move(board.m_states);
 
+	m_ply = board.m_ply;
+	m_hash = board.m_hash;
 	m_enpassant_position = board.m_enpassant_position;
+	m_promotion_positions = board.m_promotion_positions;
 	m_half_move_clock = board.m_half_move_clock;
 	m_full_move_clock = board.m_full_move_clock;
 	m_in_check = board.m_in_check;
+	m_check_mask = board.m_check_mask;
 }
 
 //Chess::Board::Board(Board&& board) noexcept = default;
@@ -137,11 +205,9 @@ const std::string Chess::Board::build_board_representation(const std::string boa
 
 void Chess::Board::make_board_from_representation(const std::string board_representation)
 {
-	if (!m_board.empty() || !m_pieces.empty()) {
-
+	if (!m_board.empty())
 		m_board.clear();
-		m_pieces.clear();
-	}
+
 	//due to the regex we can assume perfect input.
 	int position{ 0 };
 
@@ -165,507 +231,1335 @@ void Chess::Board::make_board_from_representation(const std::string board_repres
 		}
 		else {
 
-			auto tile_piece_pair(m_piece_factory.create_tile_piece_pair(*iterator, position));
-			m_board.push_back(tile_piece_pair.first);
-			m_pieces.push_back(std::move(tile_piece_pair.second));
+			m_board.push_back(Tile::from_notation(*iterator));
 			++position;
 		}
 	}
 }
 
-const std::pair<bool, int> Chess::Board::convert_coordinate_to_position(std::string coordinate) const
+void Chess::Board::generate_piece_lists()
 {
-	auto iterator = m_conversion_table.find(coordinate);
+	m_pieces.clear();
 
-	if (iterator != m_conversion_table.end()) {
+	for (int position{ 0 }; position < static_cast<int>(m_board.size()); ++position) {
 
-		return std::pair<bool, int>(true, iterator->second);
+		if (m_board[position] != TileType::Empty && m_board[position] != TileType::Border)
+			m_pieces.push_back(m_board[position], position);
 	}
-
-	//if we couldn't convert the coordinate inform the use in the bool.
-	return std::pair<bool, int>(false, 0);
 }
 
-std::vector<Chess::MoveList>::iterator Chess::Board::find_movelist(const int origin)
+const std::pair<bool, int> Chess::Board::convert_coordinate_to_position(const std::string_view coordinate) const
 {
-	auto movelist = std::find_if(m_moves.begin(), m_moves.end(), [origin](const MoveList& movelist) -> bool { return movelist.get_origin() == origin; });
-	return movelist;
-}
+	const int position{ Squares::find_position(coordinate) };
 
-void Chess::Board::print_move_list()
-{
-	std::cout << "Moves Generated for " << m_player->get_name() << ":\n";
-	for (const auto& moves : m_moves)
-		std::cout << moves << "\n";
+	//if we couldn't convert the coordinate inform the use in the bool.
+	return std::pair<bool, int>(position != 0, position);
 }
 
-const Chess::BoardState Chess::Board::state() const
+const PackedPosition Chess::Board::encode() const
 {
-	if (m_half_move_clock == 50)
-		return BoardState::Stalemate;
+	PackedPosition packed_position;
 
-	if (m_moves.size() == 0) {
+	std::uint64_t occupancy{ 0 };
+	int piece_index{ 0 };
 
-		if (m_in_check == true)
-			return BoardState::Checkmate;
-		else
-			return BoardState::Stalemate;
-	}
+	for (int square{ 0 }; square < static_cast<int>(m_game_board_x * m_game_board_y); ++square) {
 
-	return BoardState::Legal;
-}
+		const Tile& tile{ m_board[convert_square_to_position(square)] };
 
-void Chess::Board::assign_piece_pins()
-{
-	//a pin denotes a piece whos directions of movement are restricted due to such a movement uncovering a check.
-	for (const auto& piece : m_pieces) {
+		if (tile == TileType::Empty)
+			continue;
 
-		if ((piece->get_faction() == m_enemy->get_faction())) {
+		//a legal game can't have more than 32 pieces, nor can the format.
+		if (piece_index == PackedPosition::max_pieces)
+			throw std::logic_error("Logic Error: Too many pieces to pack the position.");
 
-			Pin pin{ piece->generate_pins(get_king_position(), *this) };
+		occupancy |= (std::uint64_t(1) << square);
+		packed_position.set_piece_code(piece_index++, static_cast<int>(tile.getTileType()) + ((tile == Faction::Black) ? 8 : 0));
+	}
 
-			//a non-zero pin-vector implies alignment was found and an enemy piece is infact pinned.
-			if (pin.m_vector != 0) {
+	packed_position.set_occupancy(occupancy);
+	packed_position.set_flags(m_player->get_faction() == Faction::Black, get_castle_permissions());
 
-				const auto pinned_piece = find_piece_at(pin.m_position);
-				assert((pinned_piece != m_pieces.end()) && "Pin position was not found in the piece list!");
-				(*pinned_piece)->pin(pin.m_vector);
-			}
-		}
+	if (m_enpassant_position != 0) {
+
+		//the format stores the tile skipped by the double push, as FEN does.
+		const int skipped_position{ m_enpassant_position + ((m_board[m_enpassant_position] == Faction::White) ? TileVector::south : TileVector::north) };
+		packed_position.set_enpassant_square(convert_position_to_square(skipped_position));
 	}
+	else {
+
+		packed_position.set_enpassant_square(PackedPosition::no_enpassant);
+	}
+
+	packed_position.set_half_move_clock(m_half_move_clock);
+	packed_position.set_full_move_clock(m_full_move_clock);
+
+	return packed_position;
 }
 
-void Chess::Board::generate_composite_movelist()
+const Chess::Position Chess::Board::copy_position() const
 {
-	if(m_moves.size()>0)
-		m_moves.clear();
+	Position position;
 
-	//for every piece generate a set of all moves, movelist, and then append it to a vector of movelists.
-	for (const auto& piece : m_pieces) {
+	for (int i{ 0 }; i < static_cast<int>(m_board.size()); ++i) {
 
-		if (piece->get_faction() == m_player->get_faction()) {
+		const Tile& tile{ m_board[i] };
 
-			MoveList movelist = piece->generate_move_list(*this);
+		if (tile == TileType::Empty)
+			continue;
 
-			if (movelist.size() > 0)
-				m_moves.push_back(std::move(movelist));
-		}
+		const bool is_black{ tile == Faction::Black };
+		position.m_tiles[i] = static_cast<std::uint8_t>(static_cast<int>(tile.getTileType()) + (is_black ? Position::black : 0));
+
+		if (tile == TileType::King)
+			position.m_king_positions[is_black ? 1 : 0] = static_cast<std::uint8_t>(i);
 	}
+
+	position.m_black_to_play = (m_player->get_faction() == Faction::Black) ? 1 : 0;
+	position.m_castle_permissions = static_cast<std::uint8_t>(get_castle_permissions());
+
+	//the position holds the tile skipped by the double push, the board the pawn which may be captured.
+	if (m_enpassant_position != 0)
+		position.m_enpassant_position = static_cast<std::uint8_t>(m_enpassant_position + ((m_player->get_faction() == Faction::White) ? TileVector::north : TileVector::south));
+
+	position.m_half_move_clock = static_cast<std::uint16_t>(m_half_move_clock);
+	position.m_full_move_clock = static_cast<std::uint16_t>(m_full_move_clock);
+
+	return position;
 }
 
-bool Chess::Board::find_and_execute_move(const int from, const int to)
+const std::string Chess::Board::convert_move_to_notation(const Move& move) const
 {
-	//attempt to find the 'from' position as the movelist origin.
-	auto movelist = std::find_if(m_moves.begin(), m_moves.end(), [from](const MoveList& movelist) -> bool { return movelist.get_origin() == from; });
+	std::string notation{ get_file_notation(move.m_from), get_rank_notation(move.m_from), get_file_notation(move.m_to), get_rank_notation(move.m_to) };
 
-	if (movelist != m_moves.end()) {
-
-		//check if that movelist contains the 'to' position.
-		auto move = movelist->find_in_list(to);
-		if (move != movelist->end()) {
+	if (move.m_promotion != 0)
+		notation += static_cast<char>(std::tolower(static_cast<unsigned char>(move.m_promotion)));
 
-			//execute the command.
-			execute_move_command(std::move(*move));
-			return true;
-		}
-	}
-	
-	//return false if we could not execute the command.
-	return false;
+	return notation;
 }
 
-void Chess::Board::execute_move_command(std::unique_ptr<ChessCommandBase> command)
+const std::pair<bool, Chess::Move> Chess::Board::find_san_move(const std::string_view san) const
 {
-	command->execute(*this);
+	Move found;
+	int match_count{ 0 };
 
-	if (m_board[command->get_to()] == TileType::Pawn) {
+	//strip check, mate and annotation suffixes.
+	std::size_t length{ san.find_last_not_of("+#!?") + 1 };
 
-		m_half_move_clocks.push(m_half_move_clock);
-		m_half_move_clock = 0;
-	}
-	else {
+	if (length == 0 || length > san.size())
+		return std::pair<bool, Move>(false, found);
 
-		++m_half_move_clock;
+	//castling is written as the direction rather than a destination.
+	if (san.compare(0, length, "O-O") == 0 || san.compare(0, length, "0-0") == 0 || san.compare(0, length, "O-O-O") == 0 || san.compare(0, length, "0-0-0") == 0) {
+
+		const int king_position{ get_king_position() };
+		const int vector{ (length == 3) ? TileVector::east : TileVector::west };
+
+		found.m_from = king_position;
+		found.m_to = king_position + (2 * vector);
+
+		for (const auto& movelist : m_moves) {
+
+			if (movelist.get_origin() == king_position && movelist.find_in_list(found.m_to) != movelist.end())
+				return std::pair<bool, Move>(true, found);
+		}
+		return std::pair<bool, Move>(false, found);
 	}
 
-	m_move_history.push_back(std::move(command));
-}
+	//promotions are written as a trailing piece initial, optionally after an '='.
+	char promotion{ 0 };
+	if (std::isupper(static_cast<unsigned char>(san[length - 1]))) {
 
-bool Chess::Board::execute_undo_command()
-{
-	if (m_move_history.size() == 0) {
+		promotion = san[length - 1];
+		--length;
 
-		std::cout << "Cannot undo move as no previous move exists!\n";
-		return false;
+		if (length > 0 && san[length - 1] == '=')
+			--length;
 	}
 
-	// get last move from the move history stack.
-	auto& command = m_move_history.back();
+	if (length < 2)
+		return std::pair<bool, Move>(false, found);
 
-	if (m_board[command->get_to()] == TileType::Pawn) {
+	//the destination is always the last two charachters.
+	const auto destination = convert_coordinate_to_position(san.substr(length - 2, 2));
+	if (!destination.first)
+		return std::pair<bool, Move>(false, found);
 
-		int old_clock = m_half_move_clocks.top();
+	//a leading upper case letter names the piece, otherwise it is a pawn move.
+	std::size_t first{ 0 };
+	TileType piece_type{ TileType::Pawn };
 
-		m_half_move_clock = old_clock;
-		m_half_move_clocks.pop();
+	switch (san[0])
+	{
+	case 'N': piece_type = TileType::Knight; ++first; break;
+	case 'B': piece_type = TileType::Bishop; ++first; break;
+	case 'R': piece_type = TileType::Rook; ++first; break;
+	case 'Q': piece_type = TileType::Queen; ++first; break;
+	case 'K': piece_type = TileType::King; ++first; break;
+	default: break;
 	}
-	else {
 
-		--m_half_move_clock;
+	//whatever lies between the piece and the destination disambiguates the origin, ignoring the capture marker.
+	char origin_file{ 0 };
+	char origin_rank{ 0 };
+
+	for (std::size_t i{ first }; i < length - 2; ++i) {
+
+		if (san[i] >= 'a' && san[i] <= 'h')
+			origin_file = san[i];
+		else if (san[i] >= '1' && san[i] <= '8')
+			origin_rank = san[i];
+		else if (san[i] != 'x')
+			return std::pair<bool, Move>(false, found);
 	}
 
+	for (const auto& movelist : m_moves) {
 
-	//undo it
-	command->undo(*this);
-	m_move_history.pop_back();
+		const int origin{ movelist.get_origin() };
 
-	return true;
-}
+		if (m_board[origin] != piece_type || (origin_file != 0 && get_file_notation(origin) != origin_file) || (origin_rank != 0 && get_rank_notation(origin) != origin_rank))
+			continue;
 
-void Chess::Board::move(const int from, const int to)
-{
-	//update the piece.
-	auto piece = find_piece_at(from);
-	(*piece)->move(to);
+		for (const auto& command : movelist) {
 
-	//update the board
-	m_board[to] = m_board[from];
-	m_board[from].clear();
-}
+			if (command->get_to() == destination.second && command->is_promotion() == (promotion != 0)) {
 
-void Chess::Board::undo_move(const int from, const int to)
-{
-	//update the piece.
-	auto piece = find_piece_at(from);
-	(*piece)->undo_move(to);
+				found.m_from = origin;
+				found.m_to = destination.second;
+				++match_count;
+			}
+		}
+	}
 
-	//update the board
-	m_board[to] = m_board[from];
-	m_board[from].clear();
+	//the promotion piece belongs to the player, so match the case to their faction.
+	if (promotion != 0)
+		found.m_promotion = (m_player->get_faction() == Faction::White) ? promotion : static_cast<char>(std::tolower(static_cast<unsigned char>(promotion)));
+
+	//ambiguous notation is as bad as an illegal move.
+	return std::pair<bool, Move>(match_count == 1, found);
 }
 
-void Chess::Board::revive()
+const std::string Chess::Board::convert_move_to_san(const Move& move) const
 {
-	//the last-captured piece is at the back of the captured_piece list.
-	m_pieces.push_back(std::move(m_captured_pieces.back()));
-	m_captured_pieces.pop_back();
+	const Tile& piece{ m_board[move.m_from] };
 
-	int captured_position = m_pieces.back()->get_position();
+	//castling is the only king move of two tiles.
+	if (piece == TileType::King && std::abs(move.m_to - move.m_from) == 2)
+		return (move.m_to > move.m_from) ? "O-O" : "O-O-O";
 
-	//reinstate the pieces internal board representation.
-	m_board[captured_position] = std::move(m_captured_tiles.back());
-	m_captured_tiles.pop_back();
-}
+	//a pawn changing file always captures, even onto an empty tile when enpassant.
+	const bool is_capture{ (m_board[move.m_to] != TileType::Empty) || (piece == TileType::Pawn && get_file_notation(move.m_from) != get_file_notation(move.m_to)) };
 
-void Chess::Board::capture(const int position)
-{
-	//move captured piece to capture list and remove its entry from piece list.
-	auto captured = find_piece_at(position);
+	std::string san;
 
-	assert(captured != m_pieces.end() && "Capture was not found in piecelist!");
+	if (piece == TileType::Pawn) {
 
-	//hold onto the piece object as we may need it if the user undos a move, these objects hold 'meta-data' about the piece.
-	m_captured_pieces.push_back(std::move(*captured));
-	m_pieces.erase(captured);
+		if (is_capture)
+			san += get_file_notation(move.m_from);
+	}
+	else {
 
-	m_captured_tiles.push_back(m_board[position]);
-	m_board[position].clear();
-}
+		san += static_cast<char>(std::toupper(static_cast<unsigned char>(piece.get_notation())));
 
-std::vector<std::unique_ptr<Chess::Piece>>::iterator Chess::Board::find_piece_at(const int position)
-{
-	return std::find_if(m_pieces.begin(), m_pieces.end(), [position](const std::unique_ptr<Piece>& piece) -> bool { return piece->get_position() == position; });
-}
+		//another piece of the same type reaching the destination is told apart by file if possible, then by rank, then by both.
+		bool is_ambiguous{ false };
+		bool shares_file{ false };
+		bool shares_rank{ false };
 
-const int Chess::Board::get_king_position(const Player& player) const
-{
-	for (const auto& piece : m_pieces) {
+		for (const auto& movelist : m_moves) {
 
-		int piece_position{ piece->get_position() };
+			const int origin{ movelist.get_origin() };
 
-		if((m_board[piece_position] == TileType::King) && (piece->get_faction() == m_player->get_faction()))
-			return (piece->get_position());
-	}
+			if (origin == move.m_from || m_board[origin] != piece.getTileType() || movelist.find_in_list(move.m_to) == movelist.end())
+				continue;
 
-	assert(false && "Could not find king position!");
-	return 0;
-}
+			is_ambiguous = true;
+			shares_file = shares_file || (get_file_notation(origin) == get_file_notation(move.m_from));
+			shares_rank = shares_rank || (get_rank_notation(origin) == get_rank_notation(move.m_from));
+		}
 
-const bool Chess::Board::is_position_captured(const int position)
-{
-	for (const auto& piece : m_pieces) {
+		if (is_ambiguous && (!shares_file || shares_rank))
+			san += get_file_notation(move.m_from);
+		if (is_ambiguous && shares_file)
+			san += get_rank_notation(move.m_from);
+	}
 
-		if (piece->get_faction() == m_enemy->get_faction()) {
+	if (is_capture)
+		san += 'x';
 
-			MoveList capture_list(piece->generate_capture_list(*this));
+	san += get_file_notation(move.m_to);
+	san += get_rank_notation(move.m_to);
 
-			//this only detects explicit capture commands, so won't tell you if any empty tile is attacked.
-			for (const auto& capture : capture_list) {
+	if (move.m_promotion != 0) {
 
-				if (capture->get_to() == position)
-					return true;
-			}
-		}
+		san += '=';
+		san += static_cast<char>(std::toupper(static_cast<unsigned char>(move.m_promotion)));
 	}
-	return false;
+
+	return san;
 }
 
-void Chess::Board::promote(char promotion)
+const std::size_t Chess::Board::write_fen(char* buffer, const std::size_t size) const
 {
-	//load the promotion
-	auto promotion_from_to = m_promotion_positions;
+	//a FEN string can never be longer than this, so checking once up front saves checking every charachter.
+	if (size < max_fen_length)
+		return 0;
 
-	//'capture' the pawn piece at 'from'
-	capture(promotion_from_to.first);
+	char* out{ buffer };
 
-	//make the new one at the second, the 'to' position.
-	auto promotion_pair = m_piece_factory.create_tile_piece_pair(promotion, promotion_from_to.second);
+	for (int row{ 0 }; row < static_cast<int>(m_game_board_y); ++row) {
 
-	//move the new piece into piece_list
-	m_pieces.push_back(std::move(promotion_pair.second));
-	//move the new tile onto board.
-	m_board[promotion_from_to.second] = promotion_pair.first;
+		if (row != 0)
+			*out++ = '/';
 
-	//add promotion 'to' position to the promotions stack
-	m_promotions.push(promotion_from_to.second);
+		int empty_count{ 0 };
+		const int row_position{ Squares::positions[row * Squares::game_board_x] };
 
-	//clear the promotion pair
-	m_promotion_positions = std::pair<int, int>(0, 0);
-}
+		for (int column{ 0 }; column < static_cast<int>(m_game_board_x); ++column) {
 
-void Chess::Board::undo_promote()
-{
-	//load last promotion
-	auto promotion_to = m_promotions.top();
+			const Tile& tile{ m_board[row_position + column] };
 
-	//find the piece at the promotion position and delete it
-	auto piece = find_piece_at(promotion_to);
-	m_pieces.erase(piece);
+			if (tile == TileType::Empty) {
 
-	//clear its tile.
-	m_board[promotion_to].clear();
+				++empty_count;
+				continue;
+			}
 
-	//restore pawn from dead-list.
-	revive();
+			if (empty_count != 0) {
 
-	//pop the promotion
-	m_promotions.pop();
-}
+				*out++ = static_cast<char>('0' + empty_count);
+				empty_count = 0;
+			}
+			*out++ = tile.get_notation();
+		}
 
-const std::unordered_map<std::string, int> Chess::Board::generate_conversion_table() const
-{
-	std::unordered_map<std::string, int> m_conversion_table;
+		if (empty_count != 0)
+			*out++ = static_cast<char>('0' + empty_count);
+	}
 
-	//don't worry about it, this chess 'board' is defined as being 8x8.
-	std::vector<std::string> alphabet{ "a","b","c","d","e","f","g","h" };
-	std::vector<int> position{ 8,7,6,5,4,3,2,1 };
+	*out++ = ' ';
+	*out++ = (m_player->get_faction() == Faction::White) ? 'w' : 'b';
+	*out++ = ' ';
 
-	std::string chess_notation{};
-	auto row_iterator = position.begin();
-	auto column_iterator = alphabet.begin();
+	//castling permissions are stored per player, so look them up by faction.
+	const Player& white{ (m_player->get_faction() == Faction::White) ? *m_player : *m_enemy };
+	const Player& black{ (m_player->get_faction() == Faction::White) ? *m_enemy : *m_player };
+	const char* castling_start{ out };
 
-	for (size_t i = 0; i < m_board.size(); ++i) {
+	if (white.can_castle_in_vector(TileVector::east))
+		*out++ = 'K';
+	if (white.can_castle_in_vector(TileVector::west))
+		*out++ = 'Q';
+	if (black.can_castle_in_vector(TileVector::east))
+		*out++ = 'k';
+	if (black.can_castle_in_vector(TileVector::west))
+		*out++ = 'q';
+	if (out == castling_start)
+		*out++ = '-';
 
-		//once we encounte the first non-border tile, we can begin assinging collumn indexes until encounter another
-		if (m_board[i] != TileType::Border) {
+	*out++ = ' ';
 
-			chess_notation = (*column_iterator + std::to_string(*row_iterator));
-			m_conversion_table[chess_notation] = static_cast<int>(i);
-			++column_iterator;
-		}
-		else {
+	if (m_enpassant_position != 0) {
 
-			//if the alphabet iterator has reached the end then we know we can increment the row iterator
-			if (column_iterator == alphabet.end())
-				++row_iterator;
+		//the board tracks the capturable pawn, FEN wants the tile it skipped over.
+		const int skipped_position{ m_enpassant_position + ((m_board[m_enpassant_position] == Faction::White) ? TileVector::south : TileVector::north) };
 
-			column_iterator = alphabet.begin();
-		}
+		*out++ = get_file_notation(skipped_position);
+		*out++ = get_rank_notation(skipped_position);
 	}
-	return m_conversion_table;
-}
+	else {
 
-const bool Chess::Board::is_board_valid() const
-{
-	int white_king_count{ 0 };
-	int black_king_count{ 0 };
+		*out++ = '-';
+	}
 
-	for (const auto& tile : m_board) {
+	//clocks are written back to front into a small scratch buffer, avoiding any std::string temporaries.
+	for (const int clock : { m_half_move_clock, m_full_move_clock }) {
 
-		if (tile == TileType::King) {
+		*out++ = ' ';
 
-			if (tile == Faction::White)
-				++white_king_count;
-			else if (tile == Faction::Black)
-				++black_king_count;
-		}
+		char digits[16];
+		int digit_count{ 0 };
+		unsigned int value{ static_cast<unsigned int>(clock) };
+
+		do {
+			digits[digit_count++] = static_cast<char>('0' + (value % 10));
+			value /= 10;
+		} while (value != 0);
+
+		while (digit_count != 0)
+			*out++ = digits[--digit_count];
 	}
 
-	return ((white_king_count == 1) && (black_king_count == 1));
+	*out = '\0';
+	return static_cast<std::size_t>(out - buffer);
 }
 
-void Chess::Board::pretty_print_board()
+const std::string Chess::Board::get_fen() const
 {
-	//width of each 'square' is 8
-	std::size_t horizontal_width = ((m_game_board_x * 8) + 1);
-	std::string horizontal_border = std::string(horizontal_width, '#');
-
-	//only want to print for iterators that are NOT border tiles.
-	auto board_tile_iterator = m_board.begin();
-	
-	//want to highlight pieces with moves by ornamenting with [], need to be able to traverse the moves list in order to do this.
-	std::sort(m_moves.begin(), m_moves.end(), [](const MoveList& movelist1, const MoveList& movelist2) {return(movelist1.get_origin() < movelist2.get_origin()); });
-	auto movelist = m_moves.begin();
+	char buffer[max_fen_length];
+	const std::size_t length{ write_fen(buffer, max_fen_length) };
 
-	std::cout << "       A       B       C       D       E       F       G       H\n";
-	std::cout << "   " << horizontal_border << "\n";
+	return std::string(buffer, length);
+}
 
-	for (size_t i = 0; i < m_game_board_y; i++) {
+std::vector<Chess::MoveList>::iterator Chess::Board::find_movelist(const int origin)
+{
+	auto movelist = std::find_if(m_moves.begin(), m_moves.end(), [origin](const MoveList& movelist) -> bool { return movelist.get_origin() == origin; });
+	return movelist;
+}
 
-		//print border token
-		std::cout << "   #";
-		for (size_t j = 0; j < m_game_board_x; j++) {
+void Chess::Board::print_move_list()
+{
+	std::cout << "Moves Generated for " << m_player->get_name() << ":\n";
+	for (const auto& moves : m_moves)
+		std::cout << moves << "\n";
+}
 
-			std::cout << "       #";
-		}
-		std::cout << "\n";
-
-		//print border token
-		std::cout << " " << m_game_board_y - i << " #";
-		for (size_t j = 0; j < m_game_board_x; j++) {
-
-			while (*board_tile_iterator == TileType::Border)
-				++board_tile_iterator;
-
-			std::cout << "  ";
-			if (movelist != m_moves.end() && std::distance(m_board.begin(), board_tile_iterator) == movelist->get_origin()) {
-				
-				//surround pieces with a '[ ]' if they have moves.
-				std::cout << "[" << *board_tile_iterator << "]";
-				++movelist;
-				++board_tile_iterator;
-			}
-			else {
-				//pieces without moves are decorated with circular brackets.
-				(*board_tile_iterator == m_player->get_faction()) ? std::cout << "(" << *board_tile_iterator << ")" : std::cout << " " << *board_tile_iterator << " ";
-				++board_tile_iterator;
-			}
-			std::cout << "  #";
+const Chess::BoardState Chess::Board::state() const
+{
+	//the game is over if there are no moves, and finding one is enough to know it isn't.
+	const Position position{ copy_position() };
 
-			if (j == m_game_board_x-1)
-				std::cout << " " << (m_game_board_y - i);
-		}
-		std::cout << "\n";
+	if (!position.has_legal_move()) {
 
-		//print border token
-		std::cout << "   #";
-		for (size_t j = 0; j < m_game_board_x; j++) {
+		if (position.is_in_check())
+			return BoardState::Checkmate;
+		else
+			return BoardState::Stalemate;
+	}
 
-			std::cout << "       #";
-		}
-		std::cout << "\n";
+	//the half move clock counts plies, so fifty moves each is 100.
+	if (m_half_move_clock >= 100)
+		return BoardState::Stalemate;
 
-		//print border token
-		std::cout << "   #";
-		for (size_t j = 0; j < m_game_board_x; j++) {
+	//the third occurence of a position is a draw.
+	if (is_repetition(2))
+		return BoardState::Repetition;
 
-			std::cout << "########";
-		}
-		std::cout << "\n";
-	}
-	std::cout << "       A       B       C       D       E       F       G       H\n";
+	return BoardState::Legal;
 }
-bool Chess::Board::find_and_execute_pretty_print(const int from)
+
+const int Chess::Board::count_legal_moves() const
 {
-	auto movelist = find_movelist(from);
+	return copy_position().count_moves();
+}
 
-	if (movelist == m_moves.end())
-		return false;
+const bool Chess::Board::is_repetition(const int times) const
+{
+	//the history doesn't reach back past the position the board was made from.
+	const std::size_t reversible_plies{ std::min(m_ply, static_cast<std::size_t>(m_half_move_clock)) };
+	int repetitions{ 0 };
 
-	//movelist exists, so sort, we can advance the iterator until the next move position equals the next tile on the board.
-	movelist->sort();
+	//each player has to move away and back, so the nearest possible repetition is four plies ago.
+	for (std::size_t distance{ 4 }; distance <= reversible_plies; distance += 2) {
 
-	//each box is 8 squares wide.
-	std::size_t border_width{ 1 + (m_game_board_x * 8) };
-	std::string horizontal_border = std::string(border_width, '#');
+		if (m_states[m_ply - distance].m_hash == m_hash && ++repetitions >= times)
+			return true;
+	}
 
-	//only want to print for iterators that are NOT border tiles.
-	auto board_tile_iterator = m_board.begin();
-	auto move_iterator = movelist->begin();
+	return false;
+}
 
-	std::cout << "       A       B       C       D       E       F       G       H\n";
-	std::cout << "   " << horizontal_border << "\n";
+void Chess::Board::copy_repetition_history(const Board& board)
+{
+	assert(m_ply == 0 && m_hash == board.m_hash && "Only a freshly made copy of the board can take on its history!");
 
-	for (size_t i = 0; i < m_game_board_y; i++) {
+	const std::size_t reversible_plies{ std::min(board.m_ply, static_cast<std::size_t>(board.m_half_move_clock)) };
 
-		//print border token
-		std::cout << "   #";
-		for (size_t j = 0; j < m_game_board_x; j++) {
+	//keep a spare record above the history, as making a move does.
+	if (reversible_plies + 2 > m_states.size())
+		m_states.resize(reversible_plies + 2);
 
-			std::cout << "       #";
-		}
-		std::cout << "\n";
+	for (std::size_t distance{ 1 }; distance <= reversible_plies; ++distance)
+		m_states[reversible_plies - distance].m_hash = board.m_states[board.m_ply - distance].m_hash;
 
-		//print border token
-		std::cout << " " << m_game_board_y - i << " #";
-		for (size_t j = 0; j < m_game_board_x; j++)
-		{
-			//advance the iterator till we find a non-border tile.
-			while (*board_tile_iterator == TileType::Border)
-				++board_tile_iterator;
+	m_ply = reversible_plies;
+}
 
-			std::cout << "  ";
+void Chess::Board::assign_piece_pins()
+{
+	//a pin denotes a piece whos directions of movement are restricted due to such a movement uncovering a check.
+	//pins only last for the turn they were assigned on, so clear the last turn's first.
+	m_pin_rays.fill(~std::uint64_t(0));
 
-			//if the tile is in the moves list print it as follows.
-			if (move_iterator != movelist->end()) {
+	const int king_square{ convert_position_to_square(get_king_position()) };
+	const std::uint64_t occupancy{ m_pieces.get_occupancy() };
+	const std::uint64_t player_occupancy{ m_pieces.get_occupancy(m_player->get_faction()) };
 
-				//if the current tile position = the destination of a move iteator.
-				if (std::distance(m_board.begin(), board_tile_iterator) == (*move_iterator)->get_to()) {
+	for (const TileType type : { TileType::Bishop, TileType::Rook, TileType::Queen }) {
 
-					(*board_tile_iterator != TileType::Empty) ? std::cout << "{" << *board_tile_iterator << "}" : std::cout << " " << "X" << " ";
+		for (const int position : m_pieces.get(m_enemy->get_faction(), type)) {
 
-					//advance the move iterator.
-					++move_iterator;
-					++board_tile_iterator;
-				}
-				else {
+			const int square{ convert_position_to_square(position) };
 
-					//if we didn't find a match to the movelist we need to print anyway
-					(*board_tile_iterator == m_player->get_faction()) ? std::cout << "[" << *board_tile_iterator << "]" : std::cout << " " << *board_tile_iterator << " ";
-					++board_tile_iterator;
-				}
-			}
-			else {
+			//the enemy piece must be aligned with the king along a line it moves along.
+			if (!is_aligned(type, square, king_square))
+				continue;
 
-				//if we've reached the end of the move list we need to continue to print the rest of the board.
-				(*board_tile_iterator == m_player->get_faction()) ? std::cout << "[" << *board_tile_iterator << "]" : std::cout << " " << *board_tile_iterator << " ";
-				++board_tile_iterator;
-			}
+			//only one piece may lie between it and the king, and it must be the player's.
+			const std::uint64_t between{ line_tables.m_between[square][king_square] };
+			const std::uint64_t blockers{ between & occupancy };
 
-			std::cout << "  #";
+			if (blockers == 0 || (blockers & (blockers - 1)) != 0 || (blockers & player_occupancy) == 0)
+				continue;
 
-			if (j == m_game_board_x - 1)
-				std::cout << " " << (m_game_board_y - i);
+			//the pinned piece may move anywhere between the king and the pinning piece, or take it.
+			m_pin_rays[get_lowest_square(blockers)] = between | (std::uint64_t(1) << square);
 		}
-		std::cout << "\n";
+	}
+}
 
-		//print border token
-		std::cout << "   #";
-		for (size_t j = 0; j < m_game_board_x; j++) {
+void Chess::Board::generate_composite_movelist(const MoveGeneration generation)
+{
+	if(m_moves.size()>0)
+		m_moves.clear();
+
+	//every piece with a legal move gets a movelist, the generator dispatches on the side to move once for them all.
+	MoveGenerator(*this, generation).generate(m_moves);
+}
+
+bool Chess::Board::find_and_execute_move(const int from, const int to)
+{
+	//attempt to find the 'from' position as the movelist origin.
+	auto movelist = std::find_if(m_moves.begin(), m_moves.end(), [from](const MoveList& movelist) -> bool { return movelist.get_origin() == from; });
+
+	if (movelist != m_moves.end()) {
+
+		//check if that movelist contains the 'to' position.
+		auto move = movelist->find_in_list(to);
+		if (move != movelist->end()) {
 
-			std::cout << "       #";
+			//execute the command.
+			execute_move_command(std::move(*move));
+			return true;
 		}
-		std::cout << "\n";
+	}
+	
+	//return false if we could not execute the command.
+	return false;
+}
+
+bool Chess::Board::find_and_execute_move(const Move& move)
+{
+	if (!find_and_execute_move(move.m_from, move.m_to))
+		return false;
+
+	//the command only flags the promotion, the piece is chosen afterwards. default to a queen if none was given.
+	if (is_promotion())
+		promote((move.m_promotion != 0) ? move.m_promotion : ((m_player->get_faction() == Faction::White) ? 'Q' : 'q'));
+
+	return true;
+}
+
+const bool Chess::Board::replay_move(const Move& move, const bool trusted)
+{
+	//an untrusted move may name any position, so it is kept on the board before any tile is read.
+	if (!trusted && (!is_on_board(move.m_from) || !is_on_board(move.m_to)))
+		return false;
+
+	const bool is_white{ m_player->get_faction() == Faction::White };
+	char promotion{ move.m_promotion };
+
+	//as when executing a move from the movelist, a promotion defaults to a queen.
+	if (promotion == 0 && m_board[move.m_from] == TileType::Pawn && (convert_position_to_square(move.m_to) / Squares::game_board_x) == (is_white ? 0 : Squares::game_board_y - 1))
+		promotion = is_white ? 'Q' : 'q';
+
+	if (!trusted && !is_legal(move.m_from, move.m_to, promotion))
+		return false;
+
+	//whatever movelist there was belongs to the position before the move.
+	m_moves.clear();
+
+	execute_move_command(make_command(move.m_from, move.m_to));
+
+	if (is_promotion())
+		promote(promotion);
+
+	rotate_players();
+	return true;
+}
+
+const std::size_t Chess::Board::replay(const std::vector<Move>& moves, const bool trusted)
+{
+	std::size_t plies{ 0 };
+
+	for (const Move& move : moves) {
+
+		if (!replay_move(move, trusted))
+			break;
+
+		++plies;
+	}
+
+	return plies;
+}
+
+const bool Chess::Board::undo_replay_move()
+{
+	if (m_ply == 0 || !m_states[m_ply - 1].m_command)
+		return false;
+
+	//the move was made by the player before the turn passed.
+	rotate_players();
+	execute_undo_command();
+	m_moves.clear();
+
+	return true;
+}
+
+const Chess::Move Chess::Board::get_last_move() const
+{
+	if (m_ply == 0 || !m_states[m_ply - 1].m_command)
+		return Move();
+
+	const ChessCommandBase& command{ *m_states[m_ply - 1].m_command };
+
+	//the promoted piece is still on the tile it promoted on.
+	return Move{ command.get_from(), command.get_to(), command.is_promotion() ? m_board[command.get_to()].get_notation() : static_cast<char>(0) };
+}
+
+std::unique_ptr<Chess::ChessCommandBase> Chess::Board::make_command(const int from, const int to) const
+{
+	const bool is_capture{ m_board[to] != TileType::Empty };
+
+	switch (m_board[from].getTileType())
+	{
+	case TileType::Pawn:
+	{
+		const int forward{ (m_board[from] == Faction::White) ? TileVector::north : TileVector::south };
+		const int row{ convert_position_to_square(to) / Squares::game_board_x };
+
+		if (row == 0 || row == Squares::game_board_y - 1) {
+
+			if (is_capture)
+				return std::make_unique<PromotionCaptureCommand>(from, to);
+
+			return std::make_unique<PromotionCommand>(from, to);
+		}
+
+		if (to == from + (2 * forward))
+			return std::make_unique<DoublePushCommand>(from, to);
+
+		//a pawn moving off its file onto an empty tile can only be capturing enpassant.
+		if (!is_capture && to != from + forward)
+			return std::make_unique<EnpassantCommand>(from, to, to - forward);
+
+		break;
+	}
+
+	case TileType::King:
+	{
+		//the king moves two tiles to castle, and the rook in the corner crosses it.
+		if (to == from + (2 * TileVector::east) || to == from + (2 * TileVector::west)) {
+
+			const int vector{ (to > from) ? TileVector::east : TileVector::west };
+			const int square{ convert_position_to_square(from) };
+			const int rook_square{ ((square / Squares::game_board_x) * Squares::game_board_x) + ((vector == TileVector::east) ? Squares::game_board_x - 1 : 0) };
+
+			return std::make_unique<CastleCommand>(from, to, convert_square_to_position(rook_square), from + vector, vector);
+		}
+
+		if (is_capture)
+			return std::make_unique<KingCaptureCommand>(from, to);
+
+		return std::make_unique<KingMoveCommand>(from, to);
+	}
+
+	default:
+		break;
+	}
+
+	if (is_capture)
+		return std::make_unique<CaptureCommand>(from, to);
+
+	return std::make_unique<MoveCommand>(from, to);
+}
+
+void Chess::Board::execute_move_command(std::unique_ptr<ChessCommandBase> command)
+{
+	make_move(*command);
+	m_states[m_ply - 1].m_command = std::move(command);
+}
+
+bool Chess::Board::execute_undo_command()
+{
+	if (m_ply == 0 || !m_states[m_ply - 1].m_command) {
+
+		std::cout << "Cannot undo move as no previous move exists!\n";
+		return false;
+	}
+
+	//take the last move out of its record before undoing it, so the record is clear for the next move.
+	std::unique_ptr<ChessCommandBase> command{ std::move(m_states[m_ply - 1].m_command) };
+	unmake_move(*command);
 
-		//print border token
-		std::cout << "   #";
-		for (size_t j = 0; j < m_game_board_x; j++) {
+	return true;
+}
+
+void Chess::Board::make_move(ChessCommandBase& command)
+{
+	//keep a spare record above the move for the captures made while validating the next ply's moves.
+	if (m_ply + 2 > m_states.size())
+		m_states.resize(m_states.size() * 2);
+
+	StateInfo& state{ m_states[m_ply] };
+	state.m_castle_permissions = get_castle_permissions();
+	state.m_enpassant_position = m_enpassant_position;
+	state.m_half_move_clock = m_half_move_clock;
+	state.m_hash = m_hash;
+
+	//the full move clock ticks over once black has moved.
+	if (m_board[command.get_from()] == Faction::Black)
+		++m_full_move_clock;
+
+	//an enpassant capture is only available for the move immediately after the double push.
+	update_enpassant_position(0);
+
+	revoke_castle_permissions(command.get_from());
+	revoke_castle_permissions(command.get_to());
+
+	//the mover is read before the move, a promotion only flags the pawn which moves when the piece is chosen.
+	const bool is_pawn_move{ m_board[command.get_from()] == TileType::Pawn };
+
+	command.execute(*this);
+
+	//captures are recorded in the state, pawn moves and captures reset the half move clock.
+	if (is_pawn_move || state.m_captured.m_tile != TileType::Empty)
+		m_half_move_clock = 0;
+	else
+		++m_half_move_clock;
+
+	++m_ply;
+}
+
+void Chess::Board::unmake_move(ChessCommandBase& command)
+{
+	//the command's captures are revived from the record of the ply it was made on.
+	--m_ply;
+	const StateInfo& state{ m_states[m_ply] };
+
+	command.undo(*this);
+
+	m_enpassant_position = state.m_enpassant_position;
+	set_castle_permissions(state.m_castle_permissions);
+	m_half_move_clock = state.m_half_move_clock;
+	m_hash = state.m_hash;
+
+	if (m_board[command.get_from()] == Faction::Black)
+		--m_full_move_clock;
+}
+
+const int Chess::Board::get_castle_permissions() const
+{
+	const Player& white{ (m_player->get_faction() == Faction::White) ? *m_player : *m_enemy };
+	const Player& black{ (m_player->get_faction() == Faction::White) ? *m_enemy : *m_player };
+
+	return (white.can_castle_in_vector(TileVector::east) ? 1 : 0) | (white.can_castle_in_vector(TileVector::west) ? 2 : 0)
+		| (black.can_castle_in_vector(TileVector::east) ? 4 : 0) | (black.can_castle_in_vector(TileVector::west) ? 8 : 0);
+}
 
-			std::cout << "########";
+void Chess::Board::set_castle_permissions(const int permissions)
+{
+	const int previous_permissions{ get_castle_permissions() };
+
+	Player& white{ (m_player->get_faction() == Faction::White) ? *m_player : *m_enemy };
+	Player& black{ (m_player->get_faction() == Faction::White) ? *m_enemy : *m_player };
+
+	white.set_castle_permission(TileVector::east, (permissions & 1) != 0);
+	white.set_castle_permission(TileVector::west, (permissions & 2) != 0);
+	black.set_castle_permission(TileVector::east, (permissions & 4) != 0);
+	black.set_castle_permission(TileVector::west, (permissions & 8) != 0);
+
+	m_hash ^= zobrist_keys.m_castle_permissions[previous_permissions] ^ zobrist_keys.m_castle_permissions[get_castle_permissions()];
+}
+
+void Chess::Board::rotate_players()
+{
+	std::swap(m_player, m_enemy);
+	m_hash ^= zobrist_keys.m_black_to_play;
+}
+
+void Chess::Board::update_enpassant_position(const int position)
+{
+	if (m_enpassant_position != 0)
+		m_hash ^= zobrist_keys.m_enpassant[m_enpassant_position];
+
+	m_enpassant_position = position;
+
+	if (m_enpassant_position != 0)
+		m_hash ^= zobrist_keys.m_enpassant[m_enpassant_position];
+}
+
+const std::uint64_t Chess::Board::compute_hash() const
+{
+	std::uint64_t hash{ zobrist_keys.m_castle_permissions[get_castle_permissions()] };
+
+	for (int position{ 0 }; position < static_cast<int>(m_board.size()); ++position) {
+
+		if (m_board[position] != TileType::Empty && m_board[position] != TileType::Border)
+			hash ^= zobrist_keys.m_pieces[get_zobrist_piece_index(m_board[position])][position];
+	}
+
+	if (m_enpassant_position != 0)
+		hash ^= zobrist_keys.m_enpassant[m_enpassant_position];
+
+	if (m_player->get_faction() == Faction::Black)
+		hash ^= zobrist_keys.m_black_to_play;
+
+	return hash;
+}
+
+void Chess::Board::revoke_castle_permissions(const int position)
+{
+	//starting tiles on the 10x12 internal board: a8 = 21, e8 = 25, h8 = 28, a1 = 91, e1 = 95, h1 = 98.
+	int revoked{ 0 };
+
+	switch (position)
+	{
+	case 21: revoked = 8; break;
+	case 25: revoked = 4 | 8; break;
+	case 28: revoked = 4; break;
+	case 91: revoked = 2; break;
+	case 95: revoked = 1 | 2; break;
+	case 98: revoked = 1; break;
+	default: return;
+	}
+
+	const int permissions{ get_castle_permissions() };
+
+	if ((permissions & revoked) != 0)
+		set_castle_permissions(permissions & ~revoked);
+}
+
+void Chess::Board::determine_current_check_state()
+{
+	m_in_check = is_in_check();
+	m_check_mask = ~std::uint64_t(0);
+
+	if (!m_in_check)
+		return;
+
+	//find the checking pieces among the enemy's pieces, the king can't give check.
+	const int king_square{ convert_position_to_square(get_king_position()) };
+	const Faction enemy_faction{ m_enemy->get_faction() };
+	const std::uint64_t occupancy{ m_pieces.get_occupancy() };
+
+	std::uint64_t checkers{ 0 };
+
+	//the enemy's pawns attack from the tiles our pawn would attack.
+	for (const int position : m_pieces.get(enemy_faction, TileType::Pawn))
+		if (leaper_attacks.m_pawn[(m_player->get_faction() == Faction::White) ? 0 : 1][king_square].contains_square(convert_position_to_square(position)))
+			checkers |= std::uint64_t(1) << convert_position_to_square(position);
+
+	for (const int position : m_pieces.get(enemy_faction, TileType::Knight))
+		if (leaper_attacks.m_knight[king_square].contains_square(convert_position_to_square(position)))
+			checkers |= std::uint64_t(1) << convert_position_to_square(position);
+
+	for (const TileType type : { TileType::Bishop, TileType::Rook, TileType::Queen }) {
+
+		for (const int position : m_pieces.get(enemy_faction, type)) {
+
+			const int square{ convert_position_to_square(position) };
+
+			if (!is_aligned(type, square, king_square))
+				continue;
+
+			if ((line_tables.m_between[square][king_square] & occupancy) == 0)
+				checkers |= std::uint64_t(1) << square;
 		}
-		std::cout << "\n";
 	}
-	std::cout << "       A       B       C       D       E       F       G       H\n";
+
+	//a single check is answered by taking the checking piece or blocking it, a double check only by moving the king.
+	if ((checkers & (checkers - 1)) != 0)
+		m_check_mask = 0;
+	else
+		m_check_mask = line_tables.m_between[king_square][get_lowest_square(checkers)] | checkers;
+}
+
+const bool Chess::Board::is_castle_path_safe(const int from, const int to) const
+{
+	const int to_square{ convert_position_to_square(to) };
+
+	//the king crosses the tiles between and lands on the last.
+	for (std::uint64_t path{ line_tables.m_between[convert_position_to_square(from)][to_square] | (std::uint64_t(1) << to_square) }; path != 0; path &= path - 1) {
+
+		if (is_position_captured(convert_square_to_position(get_lowest_square(path))))
+			return false;
+	}
 
 	return true;
-}
\ No newline at end of file
+}
+
+void Chess::Board::generate_legal_moves(const MoveGeneration generation)
+{
+	prepare_move_generation();
+	generate_composite_movelist(generation);
+}
+
+void Chess::Board::prepare_move_generation()
+{
+	determine_current_check_state();
+	assign_piece_pins();
+}
+
+Chess::MoveList Chess::Board::generate_piece_moves(const int origin, const MoveGeneration generation)
+{
+	if (m_board[origin] != m_player->get_faction())
+		return MoveList(origin);
+
+	prepare_move_generation();
+
+	return MoveGenerator(*this, generation).generate(origin);
+}
+
+const int Chess::Board::count_generated_moves()
+{
+	prepare_move_generation();
+
+	return MoveGenerator(*this, MoveGeneration::All).count();
+}
+
+const std::uint64_t Chess::Board::perft(const int depth, const bool bulk_count)
+{
+	if (depth == 0)
+		return 1;
+
+	if (depth == 1 && bulk_count)
+		return static_cast<std::uint64_t>(count_generated_moves());
+
+	generate_legal_moves();
+
+	//the member movelist is regenerated by every child node, so this node keeps its own.
+	std::vector<MoveList> moves{ take_move_list() };
+
+	const char* promotion_pieces{ (m_player->get_faction() == Faction::White) ? "QRBN" : "qrbn" };
+	std::uint64_t nodes{ 0 };
+
+	for (auto& movelist : moves) {
+
+		for (auto& command : movelist) {
+
+			//a promotion is a single command but four distinct moves, one per promotion piece.
+			const int variations{ command->is_promotion() ? 4 : 1 };
+
+			for (int i{ 0 }; i < variations; ++i) {
+
+				make_move(*command);
+
+				if (is_promotion())
+					promote(promotion_pieces[i]);
+
+				rotate_players();
+				nodes += perft(depth - 1, bulk_count);
+				rotate_players();
+
+				unmake_move(*command);
+			}
+		}
+	}
+
+	return nodes;
+}
+
+void Chess::Board::move(const int from, const int to)
+{
+	//update the piece.
+	m_pieces.move(m_board[from], from, to);
+
+	const auto& keys{ zobrist_keys.m_pieces[get_zobrist_piece_index(m_board[from])] };
+	m_hash ^= keys[from] ^ keys[to];
+
+	//update the board
+	m_board[to] = m_board[from];
+	m_board[from].clear();
+}
+
+void Chess::Board::undo_move(const int from, const int to)
+{
+	//update the piece.
+	m_pieces.undo_move(m_board[from], from, to);
+
+	const auto& keys{ zobrist_keys.m_pieces[get_zobrist_piece_index(m_board[from])] };
+	m_hash ^= keys[from] ^ keys[to];
+
+	//update the board
+	m_board[to] = m_board[from];
+	m_board[from].clear();
+}
+
+void Chess::Board::revive()
+{
+	restore_piece(m_states[m_ply].m_captured);
+}
+
+void Chess::Board::capture(const int position)
+{
+	remove_piece(position, m_states[m_ply].m_captured);
+}
+
+void Chess::Board::remove_piece(const int position, CapturedPiece& captured)
+{
+	//move captured piece to the record and remove its entry from piece list.
+	captured.m_tile = m_board[position];
+	captured.m_position = position;
+
+	//hold onto the piece's move count as we may need it if the user undos a move.
+	captured.m_move_count = m_pieces.get_move_count(captured.m_tile, position);
+	captured.m_index = m_pieces.remove(captured.m_tile, position);
+
+	m_hash ^= zobrist_keys.m_pieces[get_zobrist_piece_index(m_board[position])][position];
+
+	m_board[position].clear();
+}
+
+void Chess::Board::restore_piece(CapturedPiece& captured)
+{
+	//reinsert the piece where it was so the piece list order is unchanged.
+	const int position{ captured.m_position };
+	m_pieces.insert(captured.m_tile, position, captured.m_index, captured.m_move_count);
+
+	//reinstate the pieces internal board representation.
+	m_board[position] = captured.m_tile;
+
+	m_hash ^= zobrist_keys.m_pieces[get_zobrist_piece_index(m_board[position])][position];
+
+	//the record holds no piece until the next capture.
+	captured.m_tile.clear();
+}
+
+const bool Chess::Board::is_position_captured(const int position) const
+{
+	return (m_enemy->get_faction() == Faction::White) ? is_position_attacked_by<Faction::White>(position) : is_position_attacked_by<Faction::Black>(position);
+}
+
+const bool Chess::Board::is_legal(const int from, const int to, const char promotion) const
+{
+	//both positions must be tiles of the visible board.
+	if (!is_on_board(from) || !is_on_board(to))
+		return false;
+
+	const Faction faction{ m_player->get_faction() };
+	const Tile piece{ m_board[from] };
+
+	if (piece != faction || m_board[to] == faction)
+		return false;
+
+	const int from_square{ convert_position_to_square(from) };
+	const int to_square{ convert_position_to_square(to) };
+	const int side{ (faction == Faction::White) ? 0 : 1 };
+
+	//anything left on the destination is the enemy's, and is taken.
+	int captured_position{ (m_board[to] != TileType::Empty) ? to : 0 };
+	bool is_promoting{ false };
+
+	switch (piece.getTileType())
+	{
+	case TileType::Pawn:
+	{
+		const int forward{ (faction == Faction::White) ? TileVector::north : TileVector::south };
+		const int start_row{ (faction == Faction::White) ? Squares::game_board_y - 2 : 1 };
+
+		if (to == from + forward) {
+
+			if (captured_position != 0)
+				return false;
+		}
+		else if (to == from + (2 * forward)) {
+
+			if (captured_position != 0 || m_board[from + forward] != TileType::Empty || (from_square / Squares::game_board_x) != start_row)
+				return false;
+		}
+		else if (leaper_attacks.m_pawn[side][from_square].contains_square(to_square)) {
+
+			//a diagonal onto an empty tile is only an enpassant, taking the pawn which has just double pushed past it.
+			if (captured_position == 0) {
+
+				captured_position = to - forward;
+
+				if (!can_capture_enpassant(captured_position))
+					return false;
+			}
+		}
+		else {
+
+			return false;
+		}
+
+		is_promoting = (to_square / Squares::game_board_x) == ((faction == Faction::White) ? 0 : Squares::game_board_y - 1);
+		break;
+	}
+
+	case TileType::Knight:
+		if (!leaper_attacks.m_knight[from_square].contains_square(to_square))
+			return false;
+		break;
+
+	case TileType::King:
+		//the king moves a tile, or castles two.
+		if (!leaper_attacks.m_king[from_square].contains_square(to_square))
+			return (promotion == 0) && is_legal_castle(from, to);
+		break;
+
+	default:
+		//the scanning pieces need a line to the destination with nothing on it.
+		if (!is_aligned(piece.getTileType(), from_square, to_square) || (line_tables.m_between[from_square][to_square] & m_pieces.get_occupancy()) != 0)
+			return false;
+		break;
+	}
+
+	if (is_promoting) {
+
+		const char* promotion_pieces{ (faction == Faction::White) ? "QRBN" : "qrbn" };
+
+		if (promotion == 0 || std::char_traits<char>::find(promotion_pieces, 4, promotion) == nullptr)
+			return false;
+	}
+	else if (promotion != 0) {
+
+		return false;
+	}
+
+	return is_king_safe_after(from, to, captured_position);
+}
+
+const bool Chess::Board::is_legal_castle(const int from, const int to) const
+{
+	const int vector{ (to > from) ? TileVector::east : TileVector::west };
+
+	if (to != from + (2 * vector) || get_move_count(from) != 0 || !m_player->can_castle_in_vector(vector))
+		return false;
+
+	//the rook in the corner of the king's row, with nothing between them, as the movelist's castles are found.
+	const int square{ convert_position_to_square(from) };
+	const int rook_square{ ((square / Squares::game_board_x) * Squares::game_board_x) + ((vector == TileVector::east) ? Squares::game_board_x - 1 : 0) };
+	const int rook_position{ convert_square_to_position(rook_square) };
+
+	if (m_board[rook_position] != m_player->get_faction() || m_board[rook_position] != TileType::Rook || (line_tables.m_between[square][rook_square] & m_pieces.get_occupancy()) != 0)
+		return false;
+
+	//the king can't castle out of, through or into check.
+	return !is_position_captured(from) && is_castle_path_safe(from, to);
+}
+
+const bool Chess::Board::is_king_safe_after(const int from, const int to, const int captured_position) const
+{
+	const Faction enemy_faction{ m_enemy->get_faction() };
+	const int side{ (m_player->get_faction() == Faction::White) ? 0 : 1 };
+
+	const int king_square{ convert_position_to_square((m_board[from] == TileType::King) ? to : get_king_position()) };
+	const int captured_square{ (captured_position != 0) ? convert_position_to_square(captured_position) : -1 };
+
+	//the piece leaves from and lands on to, whatever it took is gone.
+	std::uint64_t occupancy{ m_pieces.get_occupancy() & ~(std::uint64_t(1) << convert_position_to_square(from)) };
+	if (captured_square >= 0)
+		occupancy &= ~(std::uint64_t(1) << captured_square);
+	occupancy |= std::uint64_t(1) << convert_position_to_square(to);
+
+	//the enemy's pawns attack from the tiles our pawn would attack.
+	for (const int position : m_pieces.get(enemy_faction, TileType::Pawn))
+		if (position != captured_position && leaper_attacks.m_pawn[side][king_square].contains_square(convert_position_to_square(position)))
+			return false;
+
+	for (const int position : m_pieces.get(enemy_faction, TileType::Knight))
+		if (position != captured_position && leaper_attacks.m_knight[king_square].contains_square(convert_position_to_square(position)))
+			return false;
+
+	if (leaper_attacks.m_king[king_square].contains_square(convert_position_to_square(get_king_position(*m_enemy))))
+		return false;
+
+	//a scanning piece attacks the king if it is aligned with it and nothing is left between them.
+	for (const TileType type : { TileType::Bishop, TileType::Rook, TileType::Queen }) {
+
+		for (const int position : m_pieces.get(enemy_faction, type)) {
+
+			const int square{ convert_position_to_square(position) };
+
+			if (position != captured_position && is_aligned(type, square, king_square) && (line_tables.m_between[square][king_square] & occupancy) == 0)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+template<Chess::Faction Enemy>
+const bool Chess::Board::is_position_attacked_by(const int position) const
+{
+	const int square{ convert_position_to_square(position) };
+
+	//a tile is one byte, so each attacker is found by comparing the whole tile, type and faction at once.
+	constexpr std::uint8_t pawn{ Tile::encode(TileType::Pawn, Enemy) };
+	constexpr std::uint8_t knight{ Tile::encode(TileType::Knight, Enemy) };
+	constexpr std::uint8_t bishop{ Tile::encode(TileType::Bishop, Enemy) };
+	constexpr std::uint8_t rook{ Tile::encode(TileType::Rook, Enemy) };
+	constexpr std::uint8_t queen{ Tile::encode(TileType::Queen, Enemy) };
+	constexpr std::uint8_t king{ Tile::encode(TileType::King, Enemy) };
+
+	//an enemy leaper attacks the position if it stands on one of the tiles the same leaper would attack from the position.
+	for (const int attacker : leaper_attacks.m_knight[square])
+		if (m_board[attacker].get_code() == knight)
+			return true;
+
+	for (const int attacker : leaper_attacks.m_king[square])
+		if (m_board[attacker].get_code() == king)
+			return true;
+
+	//the enemy's pawns attack from the tiles our pawn would attack.
+	for (const int attacker : leaper_attacks.m_pawn[FactionTraits<FactionTraits<Enemy>::enemy>::index][square])
+		if (m_board[attacker].get_code() == pawn)
+			return true;
+
+	//the scanning pieces, from the first piece along each line.
+	constexpr int diagonal_vectors[] = { TileVector::north_west, TileVector::north_east, TileVector::south_west, TileVector::south_east };
+	constexpr int straight_vectors[] = { TileVector::north, TileVector::west, TileVector::east, TileVector::south };
+
+	for (const int vector : diagonal_vectors) {
+
+		int attacker{ position + vector };
+		while (m_board[attacker] == TileType::Empty)
+			attacker += vector;
+
+		if (m_board[attacker].get_code() == bishop || m_board[attacker].get_code() == queen)
+			return true;
+	}
+
+	for (const int vector : straight_vectors) {
+
+		int attacker{ position + vector };
+		while (m_board[attacker] == TileType::Empty)
+			attacker += vector;
+
+		if (m_board[attacker].get_code() == rook || m_board[attacker].get_code() == queen)
+			return true;
+	}
+
+	return false;
+}
+
+void Chess::Board::promote(char promotion)
+{
+	//load the promotion, it belongs to the move just made.
+	auto promotion_from_to = m_promotion_positions;
+	StateInfo& state{ m_states[m_ply - 1] };
+
+	//'capture' the pawn piece at 'from'
+	remove_piece(promotion_from_to.first, state.m_promoted);
+
+	//make the new one at the second, the 'to' position.
+	const Tile promotion_tile{ Tile::from_notation(promotion) };
+
+	//add the new piece to the end of its list, and its tile onto board.
+	m_pieces.push_back(promotion_tile, promotion_from_to.second);
+	m_board[promotion_from_to.second] = promotion_tile;
+	m_hash ^= zobrist_keys.m_pieces[get_zobrist_piece_index(promotion_tile)][promotion_from_to.second];
+
+	state.m_promotion_position = promotion_from_to.second;
+
+	//clear the promotion pair
+	m_promotion_positions = std::pair<int, int>(0, 0);
+}
+
+void Chess::Board::undo_promote()
+{
+	//unmake_move has already stepped back to the promotion's ply.
+	StateInfo& state{ m_states[m_ply] };
+
+	//the promoted piece is the last of its list, so taking it off leaves the list as it was.
+	m_pieces.remove(m_board[state.m_promotion_position], state.m_promotion_position);
+
+	//clear its tile.
+	m_hash ^= zobrist_keys.m_pieces[get_zobrist_piece_index(m_board[state.m_promotion_position])][state.m_promotion_position];
+	m_board[state.m_promotion_position].clear();
+
+	//restore pawn.
+	restore_piece(state.m_promoted);
+}
+
+const bool Chess::Board::is_board_valid() const
+{
+	int white_king_count{ 0 };
+	int black_king_count{ 0 };
+
+	//a side starts with sixteen pieces and can't gain any, which is all the piece lists have room for.
+	int white_piece_count{ 0 };
+	int black_piece_count{ 0 };
+
+	for (const auto& tile : m_board) {
+
+		if (tile == Faction::White)
+			++white_piece_count;
+		else if (tile == Faction::Black)
+			++black_piece_count;
+
+		if (tile == TileType::King) {
+
+			if (tile == Faction::White)
+				++white_king_count;
+			else if (tile == Faction::Black)
+				++black_king_count;
+		}
+	}
+
+	return ((white_king_count == 1) && (black_king_count == 1) && (white_piece_count <= PieceList::capacity) && (black_piece_count <= PieceList::capacity));
+}
+
+const Chess::BoardRenderer::Cells Chess::Board::get_movelist_cells() const
+{
+	BoardRenderer::Cells cells{ get_display_cells() };
+
+	//want to highlight pieces with moves by ornamenting with [], the movelists are marked on a lookup of the board rather than sorted.
+	std::array<bool, 120> has_moves{};
+	for (const auto& movelist : m_moves)
+		has_moves[movelist.get_origin()] = true;
+
+	for (int square{ 0 }; square < static_cast<int>(cells.size()); ++square) {
+
+		const int position{ convert_square_to_position(square) };
+
+		//pieces without moves are decorated with circular brackets.
+		if (has_moves[position])
+			cells[square] = { '[', cells[square][1], ']' };
+		else if (m_board[position] == m_player->get_faction())
+			cells[square] = { '(', cells[square][1], ')' };
+	}
+
+	return cells;
+}
+
+const std::pair<bool, Chess::BoardRenderer::Cells> Chess::Board::get_piece_move_cells(const int from) const
+{
+	BoardRenderer::Cells cells{ get_display_cells() };
+
+	const auto movelist = std::find_if(m_moves.begin(), m_moves.end(), [from](const MoveList& movelist) -> bool { return movelist.get_origin() == from; });
+
+	if (movelist == m_moves.end())
+		return std::pair<bool, BoardRenderer::Cells>(false, cells);
+
+	std::array<bool, 120> is_destination{};
+	for (const auto& command : *movelist)
+		is_destination[command->get_to()] = true;
+
+	for (int square{ 0 }; square < static_cast<int>(cells.size()); ++square) {
+
+		const int position{ convert_square_to_position(square) };
+
+		//the destinations of the moves, captures are surrounded by '{ }'.
+		if (is_destination[position])
+			cells[square] = (m_board[position] != TileType::Empty) ? BoardRenderer::Cell{ '{', cells[square][1], '}' } : BoardRenderer::Cell{ ' ', 'X', ' ' };
+		else if (m_board[position] == m_player->get_faction())
+			cells[square] = { '[', cells[square][1], ']' };
+	}
+
+	return std::pair<bool, BoardRenderer::Cells>(true, cells);
+}
+
+const Chess::BoardRenderer::Cells Chess::Board::get_display_cells() const
+{
+	BoardRenderer::Cells cells;
+
+	for (int square{ 0 }; square < static_cast<int>(cells.size()); ++square)
+		cells[square] = { ' ', m_board[convert_square_to_position(square)].get_notation(), ' ' };
+
+	return cells;
+}
@@ -12,30 +12,68 @@ This class serves to keep an 'internal board representation' of the chess game,
 
 #include "BoardBase.h"
 
+#include <array>
 #include <iostream>
 #include <iomanip>
 
-#include <unordered_map>
 #include <vector>
-#include <stack>
+#include <string_view>
+#include <cstdint>
 
+#include "BoardRenderer.h"
 #include "MoveCommand.h"
 #include "MoveList.h"
+#include "PieceLists.h"
 #include "Player.h"
 #include "Tile.h"
-#include "PieceFactory.h"
 
 #include "FEN.h"
+#include "PackedPosition.h"
+#include "Position.h"
 
 namespace Chess {
 
-	class Piece;
-
 	enum class BoardState
 	{
 		Legal,
 		Checkmate,
-		Stalemate
+		Stalemate,
+		Repetition
+	};
+
+	//a piece taken off the board, with its tile and its place in the piece list so it can be put back exactly where it was. an empty tile is no piece.
+	struct CapturedPiece
+	{
+		Tile m_tile;
+		int m_position{ 0 };
+		int m_index{ 0 };
+		int m_move_count{ 0 };
+	};
+
+	//everything needed to take back a move that the move command itself can't restore, one record per ply.
+	struct StateInfo
+	{
+		//the piece the move captured, and the pawn a promotion replaced.
+		CapturedPiece m_captured;
+		CapturedPiece m_promoted;
+		int m_promotion_position{ 0 };
+
+		//the position before the move was made.
+		int m_castle_permissions{ 0 };
+		int m_enpassant_position{ 0 };
+		int m_half_move_clock{ 0 };
+		std::uint64_t m_hash{ 0 };
+
+		//only moves played through execute_move_command are kept, so the user can undo them.
+		std::unique_ptr<ChessCommandBase> m_command;
+	};
+
+	//which moves to generate, so a search can generate the moves most likely to cut it off first. captures include enpassants and promotions.
+	enum class MoveGeneration
+	{
+		All,
+		Captures,
+		Quiets
 	};
 
 	//Define the size of the 'internal' board.
@@ -43,8 +81,9 @@ namespace Chess {
 	{
 	public:
 
-		//A board can only be made from a valid FEN string.
+		//A board can only be made from a valid FEN string, or a packed position.
 		Board(const FEN& fen_notation);
+		Board(const PackedPosition& packed_position);
 		Board(Board&& board) noexcept;
 		Board& operator=(Board&& board) noexcept;
 
@@ -57,58 +96,160 @@ namespace Chess {
 		//---
 		const std::string build_board_representation(const std::string board_representation) const;
 		void make_board_from_representation(const std::string board_representation);
-		const std::pair<bool, int> convert_coordinate_to_position(std::string coordinate) const;
+		//the position of an algebraic coordinate, e.g "e4", false if it is not on the board.
+		const std::pair<bool, int> convert_coordinate_to_position(const std::string_view coordinate) const;
+
+		//convert between a square index, 0 (a8) to 63 (h1), and a position on the internal board.
+		inline const int convert_square_to_position(const int square) const { return Squares::positions[square]; }
+		inline const int convert_position_to_square(const int position) const { return Squares::squares[position]; }
+
+		//encode the current position into the fixed-size binary format.
+		const PackedPosition encode() const;
+		//a trivially copyable snapshot of the current position, for copy-make tree walks.
+		const Position copy_position() const;
+
+		//the algebraic file ('a'-'h') and rank ('1'-'8') charachters of a board position.
+		inline const char get_file_notation(const int position) const { return Squares::get_file_notation(Squares::squares[position]); }
+		inline const char get_rank_notation(const int position) const { return Squares::get_rank_notation(Squares::squares[position]); }
+
+		//write a move in long algebraic notation, e.g. e2e4 or e7e8q.
+		const std::string convert_move_to_notation(const Move& move) const;
+
+		//resolve a move in standard algebraic notation (e.g. Nbd7, exd6, O-O, e8=Q) against the generated movelist.
+		const std::pair<bool, Move> find_san_move(const std::string_view san) const;
+		//the standard algebraic notation of a legal move, e.g 'Nbd2', 'exd5' or 'e8=Q', without a check suffix. uses the current movelist to disambiguate.
+		const std::string convert_move_to_san(const Move& move) const;
+
+		//write the current position as FEN into a caller-provided buffer without allocating, returns the length written (0 if the buffer is too small).
+		static constexpr std::size_t max_fen_length{ 128 };
+		const std::size_t write_fen(char* buffer, const std::size_t size) const;
+		const std::string get_fen() const;
 
 		//Methods for generating piece moves.
-		void generate_composite_movelist();
+		void generate_composite_movelist(const MoveGeneration generation = MoveGeneration::All);
 		void assign_piece_pins();
 
 		//the concept of turns is fulfilled using this:
-		void rotate_players() { std::swap(m_player, m_enemy); }
+		void rotate_players();
 		const Player& get_player() const { return *m_player; }
 		const Player& get_enemy() const { return *m_enemy; }
 
 		std::vector<MoveList>::iterator find_movelist(const int origin);
-		std::vector<std::unique_ptr<Piece>>::iterator find_piece_at(const int position);
 		bool find_and_execute_move(const int from, const int to);
-
-		//print methods:
-		bool find_and_execute_pretty_print(const int from);
-		void pretty_print_board();
+		//execute a resolved move, including its choice of promotion piece.
+		bool find_and_execute_move(const Move& move);
+
+		//play a move and pass the turn without generating the movelist, for replaying games quickly. the move is checked with is_legal unless it is trusted,
+		//and a promotion without a piece promotes to a queen. the movelist is left empty, generate_legal_moves builds it if the final position needs it.
+		//returns false, having played nothing, if the move is illegal.
+		const bool replay_move(const Move& move, const bool trusted = false);
+		//replay a sequence of moves, returning how many were played before the first illegal one.
+		const std::size_t replay(const std::vector<Move>& moves, const bool trusted = false);
+		//take back the last move replay_move played, and hand the turn back. returns false if there is no move to take back.
+		const bool undo_replay_move();
+		//the last move played through replay_move or execute_move_command, with the piece a promotion chose. a default move if there is none.
+		const Move get_last_move() const;
+
+		//print methods, the board only says what each tile shows, whoever prints it owns the renderer:
+		//the tiles as the renderer draws them, undecorated e.g " K ".
+		const BoardRenderer::Cells get_display_cells() const;
+		//the tiles with the player's pieces decorated, '[K]' if the piece has moves in the movelist and '(K)' if it has none.
+		const BoardRenderer::Cells get_movelist_cells() const;
+		//the tiles with the moves of the player's piece at from marked, ' X ' for a move and '{p}' for a capture. false if the piece has no moves.
+		const std::pair<bool, BoardRenderer::Cells> get_piece_move_cells(const int from) const;
 		void print_move_list();
 
 		//methods related to game legality:
 		const Faction get_player_faction() const { return m_player->get_faction(); }
 		const BoardState state() const;
+		//whether the player to move has a legal move, stopping at the first one, and how many they have (promotions once per piece). neither builds any
+		//move commands, so they don't need or change the movelist.
+		const bool has_legal_move() const { return copy_position().has_legal_move(); }
+		const int count_legal_moves() const;
 
-		//Need to expose the half move clock as if it ticks to 50 the game is over (stalemate)
+		//the half move clock counts plies since the last capture or pawn move, at 100 (fifty moves each) the game is drawn.
 		const int get_half_move_clock() const { return m_half_move_clock; }
+		const int get_full_move_clock() const { return m_full_move_clock; }
+
+		//has the position been seen the given number of times before? only positions since the last capture or pawn move, with the same player to move, can
+		//repeat it, so only their hashes are compared.
+		const bool is_repetition(const int times = 1) const;
+		//take on the hashes of the positions another board in the same position passed through since its last capture or pawn move, so a board made
+		//from a packed copy of it (see encode) finds the same repetitions. only the hashes are copied, the moves can't be undone.
+		void copy_repetition_history(const Board& board);
 		
-		void determine_current_check_state() { m_in_check = is_in_check(); }
+		//determine check, and the squares a move other than the king's must land on to answer it.
+		void determine_current_check_state();
 		const bool get_current_check_state() { return m_in_check; }
+		//a bit per square, a8 is bit 0. out of check this is every square, in check it is the checking piece and the tiles between it and the king, and in
+		//double check it is none, as only the king can move.
+		inline const std::uint64_t get_check_mask() const { return m_check_mask; }
 		
 		inline const int get_king_position() const { return get_king_position(*m_player); }
-		const int get_king_position(const Player& player) const;
+		inline const int get_king_position(const Player& player) const { return m_pieces.get(player.get_faction(), TileType::King).m_positions[0]; }
+
+		const bool is_in_check() const { return is_position_captured(get_king_position()); }
+		const bool is_position_captured(const int position) const;
 
-		const bool is_in_check() { return is_position_captured(get_king_position()); }
-		const bool is_position_captured(const int position);
+		//is the move legal for the player to move? only the moving piece, its path, the pieces that could pin it and the king's safety are looked at, no
+		//moves are generated or made, and it agrees with the movelist. a promotion must name one of the player's promotion pieces (e.g 'Q' or 'q'), other
+		//moves no promotion (0).
+		const bool is_legal(const int from, const int to, const char promotion = 0) const;
 		
 		//Methods related to Command Pattern:
 		void move(const int from, const int to);
 		void undo_move(const int from, const int to);
-		//restore the piece at the top of the dead pieces stack.
+		//restore the piece captured at the current ply.
 		void revive();
 		void capture(const int position);
 
 		void execute_move_command(std::unique_ptr<ChessCommandBase> command);
 		bool execute_undo_command();
 
+		//make/unmake a move without recording it in the history, used when searching the game tree.
+		void make_move(ChessCommandBase& command);
+		void unmake_move(ChessCommandBase& command);
+
+		//prepare the player to move: determine check, assign pins and build the movelist.
+		void generate_legal_moves(const MoveGeneration generation = MoveGeneration::All);
+		//determine check and assign pins alone, which a MoveGenerator needs before it is made.
+		void prepare_move_generation();
+		//the legal moves of the player's piece at origin alone, an empty list if there isn't one. doesn't change the movelist.
+		MoveList generate_piece_moves(const int origin, const MoveGeneration generation);
+		std::vector<MoveList> take_move_list() { return std::move(m_moves); }
+
+		//count the leaf nodes of the game tree to a given depth, promotions count once per promotion piece. a bulk count counts the last ply's moves with the
+		//same move generation, without making them or building their commands.
+		const std::uint64_t perft(const int depth, const bool bulk_count = true);
+
+		//the squares the piece at the position may move to without uncovering a check, a bit per square (a8 is bit 0). a pinned piece may only move along
+		//the line between its king and the pinning piece, or take the pinning piece, every bit is set for a piece that isn't pinned. see assign_piece_pins.
+		inline const std::uint64_t get_pin_ray(const int position) const { return m_pin_rays[Squares::squares[position]]; }
+		inline const std::array<std::uint64_t, 64>& get_pin_rays() const { return m_pin_rays; }
+		//the number of moves made by the piece at the position, a king that has moved can't castle.
+		inline const int get_move_count(const int position) const { return m_pieces.get_move_count(m_board[position], position); }
+
 		//for the CastleCommand
 		inline const bool can_castle_in_vector(int vector) const { return m_player->can_castle_in_vector(vector); }
+		//are the tiles the king crosses and lands on when castling free of attack?
+		const bool is_castle_path_safe(const int from, const int to) const;
+		//the squares either side's pieces stand on, a8 is bit 0.
+		inline const std::uint64_t get_occupancy() const { return m_pieces.get_occupancy(); }
+		//where each side's pieces are, by type.
+		inline const PieceLists& get_pieces() const { return m_pieces; }
+
+		//castling permissions of both players packed as a mask (K = 1, Q = 2, k = 4, q = 8) so they can be saved and restored cheaply.
+		const int get_castle_permissions() const;
+		void set_castle_permissions(const int permissions);
+
+		//the Zobrist hash of the position, see Zobrist.h. it is kept up to date as pieces move.
+		const std::uint64_t get_hash() const { return m_hash; }
 		
 		//for the EnpassantCommand
-		void update_enpassant_position(const int position) { m_enpassant_position = position; }
+		void update_enpassant_position(const int position);
 		inline const bool can_capture_enpassant(const int position) const { return (position == m_enpassant_position); }
+		//the pawn which may be captured enpassant, or 0.
+		inline const int get_enpassant_position() const { return m_enpassant_position; }
 
 		//for the PromotionCommand
 		void flag_promotion(const std::pair<int, int> promotion_from_to) { m_promotion_positions = promotion_from_to; }
@@ -116,17 +257,47 @@ namespace Chess {
 		void promote(char promotion);
 		void undo_promote();
 
-		//define a method to be able to easily convert from chess notation to position coordinate
-		const std::unordered_map<std::string, int> generate_conversion_table() const;
-
 		//constant, read only access to board tiles
 		virtual const Tile& operator[](const int position) const override { return m_board[position]; }
+		inline const std::size_t size() const { return m_board.size(); }
 
 	protected:
 
-		//each player must have a king.
+		//each player must have a king, and no more pieces than they start with.
 		virtual const bool is_board_valid() const override;
 
+		//fill the piece lists from the tiles, once the board has been made.
+		void generate_piece_lists();
+
+		//moving a king or rook from, or capturing a rook on, its starting tile removes the permission it grants.
+		void revoke_castle_permissions(const int position);
+
+		//the hash worked out from scratch, m_hash is only built this way when a board is made.
+		const std::uint64_t compute_hash() const;
+
+		//is the position attacked by a piece of the enemy faction? compiled once per faction, as the enemy is fixed for the whole test.
+		template<Faction Enemy>
+		const bool is_position_attacked_by(const int position) const;
+
+		//is the position a tile of the visible board?
+		inline const bool is_on_board(const int position) const { return (position >= 0) && (position < static_cast<int>(m_board.size())) && (Squares::squares[position] >= 0); }
+
+		//the number of legal moves of the player to move, counted by the move generation rather than copied into a Position as count_legal_moves does.
+		const int count_generated_moves();
+
+		//the command which plays the move of the piece at from to to, worked out from the tiles alone. the move must be legal.
+		std::unique_ptr<ChessCommandBase> make_command(const int from, const int to) const;
+
+		//the castling half of is_legal, the king moving two tiles towards a rook in its corner.
+		const bool is_legal_castle(const int from, const int to) const;
+		//would the player's king be safe once the piece at from has moved to to, and the piece at captured_position (0 for none) was taken? the pieces are
+		//left where they are, the enemy's attacks on the king are tested against the occupancy the move would leave.
+		const bool is_king_safe_after(const int from, const int to, const int captured_position) const;
+
+		//take a piece off the board into a record, and put it back.
+		void remove_piece(const int position, CapturedPiece& captured);
+		void restore_piece(CapturedPiece& captured);
+
 	private:
 
 		//standard chess is played by two players.
@@ -135,17 +306,16 @@ namespace Chess {
 
 		//is the current 'board-state' in check
 		bool m_in_check;
+		std::uint64_t m_check_mask{ ~std::uint64_t(0) };
 
 		//location of a possible enpassant piece, dictated by FEN notation
 		int m_enpassant_position;
 
 		//location of the piece to be promoted and the tile it promotes on.
 		std::pair<int, int> m_promotion_positions{ std::pair<int,int>(0,0) };
-		std::stack<int, std::vector<int>> m_promotions;
 
-		//number of 'half-moves' used for the 50-turn draw rule.
+		//plies since the last capture or pawn move, for the fifty move draw rule.
 		int m_half_move_clock{ 0 };
-		std::stack<int, std::vector<int>> m_half_move_clocks;
 
 		//total number of moves made in the game.
 		int m_full_move_clock{ 1 };
@@ -155,20 +325,24 @@ namespace Chess {
 		std::size_t m_game_board_y{ 8 };
 
 		std::vector<Tile> m_board;
-		std::vector<Tile> m_captured_tiles;
 
-		//factory to refactor some of the 'generate piece' clutter.
-		PieceFactory m_piece_factory;
-		std::vector<std::unique_ptr<Piece>> m_pieces;
-		std::vector<std::unique_ptr<Piece>> m_captured_pieces;
+		//where each side's pieces are, by type.
+		PieceLists m_pieces;
+
+		//the pin rays of the player to move's pieces, indexed by square, assigned before their moves are generated.
+		std::array<std::uint64_t, 64> m_pin_rays{};
 
 		//each piece generates a movelist of possible moves.
 		std::vector<MoveList> m_moves;
-		//after execution, store each move command here. This allows for easy undoing thanks to command-pattern!
-		std::vector<std::unique_ptr<ChessCommandBase>> m_move_history;
 
-		//a conversion table for converting between algebraic notation, (a1,a2...) to a vector index in the board.
-		std::unordered_map<std::string, int> m_conversion_table;
+		//the undo state of every move made, indexed by ply. m_states[m_ply] is the record the next move fills, it's also where a capture made to validate a move
+		//is held. allocated up front and only grown for very long games, so making a move never allocates.
+		static constexpr std::size_t initial_states{ 512 };
+		std::vector<StateInfo> m_states;
+		std::size_t m_ply{ 0 };
+
+		std::uint64_t m_hash{ 0 };
+
 	};
 }
 
@@ -10,6 +10,8 @@ This class serves as a conceptual base of a 'game board'
 #ifndef __BOARDBASE_HEADER
 #define __BOARDBASE_HEADER
 
+#include <array>
+#include <string_view>
 #include <vector>
 
 //board consists of a collection of 'tiletypes'
@@ -48,6 +50,67 @@ public:
 		static constexpr int north_north_west = north + north_west;
 	};
 
+	//the visible board sits inside a border, a tile wide at the sides and two tiles deep at the top and bottom, so a knight's jump from any visible tile lands
+	//on the board or its border.
+	struct Squares
+	{
+		static constexpr int border_width = 1;
+		static constexpr int border_height = 2;
+
+		static constexpr int game_board_x = X - (2 * border_width);
+		static constexpr int game_board_y = Y - (2 * border_height);
+
+		static constexpr int count = game_board_x * game_board_y;
+
+		//squares count from the top left of the visible board (a8 for chess) along the rows, positions along the rows of the whole board.
+		static constexpr std::array<int, count> generate_positions()
+		{
+			std::array<int, count> positions{};
+
+			for (int square{ 0 }; square < count; ++square)
+				positions[square] = ((border_height + (square / game_board_x)) * X) + border_width + (square % game_board_x);
+
+			return positions;
+		}
+
+		//border positions have no square, and are left as -1.
+		static constexpr std::array<int, X * Y> generate_squares()
+		{
+			std::array<int, X * Y> squares{};
+
+			const std::array<int, count> visible{ generate_positions() };
+
+			for (auto& square : squares)
+				square = -1;
+
+			for (int square{ 0 }; square < count; ++square)
+				squares[visible[square]] = square;
+
+			return squares;
+		}
+
+		static constexpr std::array<int, count> positions{ generate_positions() };
+		static constexpr std::array<int, X * Y> squares{ generate_squares() };
+
+		static constexpr char get_file_notation(const int square) { return static_cast<char>('a' + (square % game_board_x)); }
+		static constexpr char get_rank_notation(const int square) { return static_cast<char>('0' + (game_board_y - (square / game_board_x))); }
+
+		//the position of a coordinate such as "e4", or 0 (always a border position) if it is not on the board.
+		static constexpr int find_position(const std::string_view coordinate)
+		{
+			if (coordinate.size() != 2)
+				return 0;
+
+			const int file{ coordinate[0] - 'a' };
+			const int rank{ coordinate[1] - '1' };
+
+			if (file < 0 || file >= game_board_x || rank < 0 || rank >= game_board_y)
+				return 0;
+
+			return positions[((game_board_y - 1 - rank) * game_board_x) + file];
+		}
+	};
+
 protected:
 
 	//imagine the case someone sets up a chessboard without any kings! or multiple...
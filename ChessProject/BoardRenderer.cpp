@@ -0,0 +1,155 @@
+#include "BoardRenderer.h"
+
+namespace {
+
+	//each tile is 8 charachters wide including its right-hand border.
+	constexpr std::size_t tile_width{ 8 };
+	//the rank number and left-hand border, then two spaces of padding.
+	constexpr std::size_t first_cell_column{ 6 };
+}
+
+Chess::BoardRenderer::BoardRenderer()
+{
+	const std::string files{ "       A       B       C       D       E       F       G       H\n" };
+	const std::string border{ "   " + std::string((8 * tile_width) + 1, '#') + "\n" };
+
+	std::string spacer{ "   #" };
+	for (int file{ 0 }; file < 8; ++file)
+		spacer += "       #";
+	spacer += "\n";
+
+	m_template += files;
+	m_template += border;
+
+	for (int rank{ 0 }; rank < 8; ++rank) {
+
+		const char rank_notation{ static_cast<char>('8' - rank) };
+
+		m_template += spacer;
+
+		m_template += ' ';
+		m_template += rank_notation;
+		m_template += " #";
+
+		for (int file{ 0 }; file < 8; ++file) {
+
+			m_template += "  ";
+			m_cell_offsets[(rank * 8) + file] = m_template.size();
+			m_template += "     #";
+		}
+
+		m_template += ' ';
+		m_template += rank_notation;
+		m_template += '\n';
+
+		m_template += spacer;
+		m_template += border;
+	}
+
+	m_template += files;
+
+	//room for the status line too, so drawing a frame never allocates.
+	m_frame.reserve(m_template.size() + frame_width + 1);
+	m_patch.reserve(64 * 32 + frame_width);
+	m_status.reserve(frame_width);
+}
+
+void Chess::BoardRenderer::render(const Cells& cells, const std::string_view status, std::ostream& os)
+{
+	m_frame.assign(m_template);
+
+	for (std::size_t square{ 0 }; square < cells.size(); ++square)
+		m_frame.replace(m_cell_offsets[square], cells[square].size(), cells[square].data(), cells[square].size());
+
+	if (!status.empty())
+		append_status(m_frame, status);
+
+	os.write(m_frame.data(), static_cast<std::streamsize>(m_frame.size()));
+	os.flush();
+
+	m_cells = cells;
+	m_status.assign(status);
+	m_drawn = true;
+}
+
+void Chess::BoardRenderer::redraw(const Cells& cells, const std::string_view status, std::ostream& os)
+{
+	//the status line moves the frame up a line, so gaining or losing it needs the whole frame.
+	if (!m_drawn || (status.empty() != m_status.empty())) {
+
+		render(cells, status, os);
+		return;
+	}
+
+	m_patch.clear();
+
+	for (std::size_t square{ 0 }; square < cells.size(); ++square) {
+
+		if (cells[square] == m_cells[square])
+			continue;
+
+		//the rank's cells are on the second of its four lines, after the header and top border.
+		const std::size_t line{ 3 + (4 * (square / 8)) };
+		const std::size_t column{ first_cell_column + (tile_width * (square % 8)) };
+
+		patch(line, column, std::string_view(cells[square].data(), cells[square].size()));
+	}
+
+	//padded to the full width, so a shorter status overwrites all of a longer one.
+	if (status != m_status)
+		patch(board_lines, 0, status.substr(0, frame_width), frame_width);
+
+	if (!m_patch.empty()) {
+
+		os.write(m_patch.data(), static_cast<std::streamsize>(m_patch.size()));
+		os.flush();
+	}
+
+	m_cells = cells;
+	m_status.assign(status);
+}
+
+void Chess::BoardRenderer::patch(const std::size_t line, const std::size_t column, const std::string_view text, const std::size_t width)
+{
+	//the cursor rests at the start of the line beneath the frame.
+	const std::size_t lines_up{ (board_lines + (m_status.empty() ? 0 : 1)) - line };
+
+	m_patch += "\x1b[";
+	append_number(m_patch, lines_up);
+	m_patch += "A\x1b[";
+	append_number(m_patch, column + 1);
+	m_patch += 'G';
+
+	m_patch += text;
+
+	if (width > text.size())
+		m_patch.append(width - text.size(), ' ');
+
+	m_patch += "\x1b[";
+	append_number(m_patch, lines_up);
+	m_patch += "B\r";
+}
+
+void Chess::BoardRenderer::append_number(std::string& buffer, std::size_t number) const
+{
+	char digits[20];
+	std::size_t count{ 0 };
+
+	do {
+
+		digits[count++] = static_cast<char>('0' + (number % 10));
+		number /= 10;
+	} while (number != 0);
+
+	while (count != 0)
+		buffer += digits[--count];
+}
+
+void Chess::BoardRenderer::append_status(std::string& buffer, const std::string_view status) const
+{
+	const std::string_view shown{ status.substr(0, frame_width) };
+
+	buffer += shown;
+	buffer.append(frame_width - shown.size(), ' ');
+	buffer += '\n';
+}
@@ -0,0 +1,66 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to draw the board in the terminal. A frame is built in one buffer, allocated once, from a template of the board's borders, and written out with
+a single write, rather than a write per tile. Once a frame has been drawn, the next can be drawn by rewriting only the tiles that changed, moving the cursor back
+over the frame with ANSI escape codes. That only works if nothing else has been written since, so whoever draws the board must invalidate the frame when
+they write anything else, such as echoed input.
+*/
+
+#ifndef __BOARDRENDERER_HEADER
+#define __BOARDRENDERER_HEADER
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace Chess {
+
+	class BoardRenderer
+	{
+	public:
+		//each tile is drawn as three charachters, e.g " K ", "[K]" or " X ". indexed by square, 0 (a8) to 63 (h1).
+		using Cell = std::array<char, 3>;
+		using Cells = std::array<Cell, 64>;
+
+		BoardRenderer();
+		~BoardRenderer() {}
+
+		//draw the whole frame, with an optional status line beneath it.
+		void render(const Cells& cells, const std::string_view status, std::ostream& os);
+		//draw only what changed since the last frame. the cursor must still be where the last frame left it, otherwise the whole frame is drawn.
+		void redraw(const Cells& cells, const std::string_view status, std::ostream& os);
+		//something else has been written since the last frame, e.g the player's input, so the next redraw must draw the whole frame.
+		inline void invalidate() { m_drawn = false; }
+
+	private:
+
+		//move the cursor up to a line of the frame and across to a column, write there (padded with spaces to width), and go back to beneath the frame.
+		void patch(const std::size_t line, const std::size_t column, const std::string_view text, const std::size_t width = 0);
+		void append_number(std::string& buffer, std::size_t number) const;
+		void append_status(std::string& buffer, const std::string_view status) const;
+
+		//the frame without any pieces, and where each tile's cell sits in it.
+		std::string m_template;
+		std::array<std::size_t, 64> m_cell_offsets{};
+
+		std::string m_frame;
+		std::string m_patch;
+
+		//what is on screen.
+		Cells m_cells{};
+		std::string m_status;
+		bool m_drawn{ false };
+
+		static constexpr std::size_t frame_width{ 68 };
+		//the header, top border, four lines per rank and the footer.
+		static constexpr std::size_t board_lines{ 35 };
+	};
+}
+
+#endif
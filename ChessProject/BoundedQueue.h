@@ -0,0 +1,86 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves as a fixed-capacity, thread-safe queue used to hand work between threads. A producer blocks while the queue is full, so a fast reader can never
+race ahead of the workers and fill memory, and consumers block while it is empty. Closing the queue lets consumers drain the remaining items and then stop.
+*/
+
+#ifndef __BOUNDEDQUEUE_HEADER
+#define __BOUNDEDQUEUE_HEADER
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+template<class Item>
+class BoundedQueue
+{
+public:
+	BoundedQueue(const std::size_t capacity) : m_capacity(capacity) {}
+	~BoundedQueue() {}
+
+	//holds a mutex and condition variables, so it can neither be copied nor moved.
+	BoundedQueue(const BoundedQueue& queue) = delete;
+	BoundedQueue& operator=(const BoundedQueue& queue) = delete;
+
+	//blocks while the queue is full, returns false if the queue was closed before the item could be added.
+	bool push(Item item)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_not_full.wait(lock, [this]() { return (m_items.size() < m_capacity) || m_closed; });
+
+		if (m_closed)
+			return false;
+
+		m_items.push_back(std::move(item));
+		lock.unlock();
+
+		m_not_empty.notify_one();
+		return true;
+	}
+
+	//blocks while the queue is empty, returns false once the queue is closed and drained.
+	bool pop(Item& item)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_not_empty.wait(lock, [this]() { return !m_items.empty() || m_closed; });
+
+		if (m_items.empty())
+			return false;
+
+		item = std::move(m_items.front());
+		m_items.pop_front();
+		lock.unlock();
+
+		m_not_full.notify_one();
+		return true;
+	}
+
+	//no more items will be pushed, wake everyone up so they can finish.
+	void close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_closed = true;
+		}
+
+		m_not_empty.notify_all();
+		m_not_full.notify_all();
+	}
+
+private:
+
+	std::size_t m_capacity;
+	bool m_closed{ false };
+
+	std::deque<Item> m_items;
+
+	std::mutex m_mutex;
+	std::condition_variable m_not_empty;
+	std::condition_variable m_not_full;
+};
+
+#endif
@@ -0,0 +1,100 @@
+#include "EPD.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <cctype>
+
+EPD::EPD(const std::string& record)
+{
+	std::istringstream s_stream(record);
+	std::string field;
+
+	//the first four fields are shared with FEN.
+	for (int i{ 0 }; i < 4; ++i) {
+
+		if (!(s_stream >> field))
+			throw std::logic_error("Invalid EPD record! A record must begin with four FEN fields.");
+
+		m_position += (i == 0) ? field : (" " + field);
+	}
+
+	std::string operations;
+	std::getline(s_stream, operations);
+
+	//split the operations on ';', operands are separated by whitespace unless quoted.
+	std::vector<std::string> tokens;
+	std::string token;
+	bool quoted{ false };
+
+	auto end_operation = [this, &tokens]() {
+
+		if (tokens.empty())
+			return;
+
+		//some suites keep the FEN clocks before the first operation, treat them as hmvc/fmvn.
+		if (m_operations.empty() && std::isdigit(static_cast<unsigned char>(tokens.front()[0]))) {
+
+			m_operations.emplace_back("hmvc", std::vector<std::string>{ tokens.front() });
+			if (tokens.size() > 1)
+				m_operations.emplace_back("fmvn", std::vector<std::string>{ tokens[1] });
+		}
+		else {
+
+			m_operations.emplace_back(tokens.front(), std::vector<std::string>(tokens.begin() + 1, tokens.end()));
+		}
+		tokens.clear();
+	};
+
+	for (const char c : operations) {
+
+		if (c == '"') {
+
+			quoted = !quoted;
+		}
+		else if (!quoted && (c == ';' || std::isspace(static_cast<unsigned char>(c)))) {
+
+			if (!token.empty()) {
+
+				tokens.push_back(token);
+				token.clear();
+			}
+
+			if (c == ';')
+				end_operation();
+		}
+		else {
+
+			token += c;
+		}
+	}
+
+	if (!token.empty())
+		tokens.push_back(token);
+
+	end_operation();
+}
+
+const std::string EPD::get_fen() const
+{
+	const std::vector<std::string> half_move_clock{ get_operands("hmvc") };
+	const std::vector<std::string> full_move_clock{ get_operands("fmvn") };
+
+	return m_position + " " + (half_move_clock.empty() ? "0" : half_move_clock.front()) + " " + (full_move_clock.empty() ? "1" : full_move_clock.front());
+}
+
+const std::string EPD::get_id() const
+{
+	const std::vector<std::string> id{ get_operands("id") };
+	return id.empty() ? std::string() : id.front();
+}
+
+const std::vector<std::string> EPD::get_operands(const std::string& opcode) const
+{
+	for (const auto& operation : m_operations) {
+
+		if (operation.first == opcode)
+			return operation.second;
+	}
+
+	return std::vector<std::string>();
+}
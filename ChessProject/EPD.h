@@ -0,0 +1,45 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class implements the parsing of Extended Position Description (EPD) records, as used by test-suites.
+
+Extended Position Description:
+the record begins with the first four fields of FEN (board, player to play, castling rights and enpassant position), the clocks are omitted.
+what follows is a list of operations, each an opcode followed by zero or more operands and terminated by a ';', e.g: bm Nf3 Nc3; id "suite.001";
+common opcodes are 'bm' (best move), 'am' (avoid move), 'id' (name of the position), 'hmvc'/'fmvn' (the clocks) and 'D1'...'Dn' or 'perft n' (perft counts).
+*/
+
+#ifndef __EPD_HEADER
+#define __EPD_HEADER
+
+#include <string>
+#include <vector>
+#include <utility>
+
+class EPD
+{
+public:
+	EPD(const std::string& record);
+	~EPD() {}
+
+	//EPD omits the clocks, so build a full FEN string, taking the clocks from the hmvc/fmvn operations when present.
+	const std::string get_fen() const;
+	const std::string get_id() const;
+
+	//the operands of the first operation with the given opcode, empty if the record does not contain it.
+	const std::vector<std::string> get_operands(const std::string& opcode) const;
+
+	//each operation is an opcode and its operands.
+	const std::vector<std::pair<std::string, std::vector<std::string>>>& get_operations() const { return m_operations; }
+
+private:
+
+	//the four FEN fields that every record starts with.
+	std::string m_position;
+	std::vector<std::pair<std::string, std::vector<std::string>>> m_operations;
+};
+
+#endif
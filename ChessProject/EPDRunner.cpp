@@ -0,0 +1,203 @@
+#include "EPDRunner.h"
+
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+
+#include "BoundedQueue.h"
+#include "EPD.h"
+#include "Search.h"
+
+Chess::EPDRunner::EPDRunner(const unsigned int thread_count, const int search_depth, const int max_perft_depth) : m_thread_count(std::max(1u, thread_count)), m_search_depth(search_depth), m_max_perft_depth(max_perft_depth) {}
+
+const bool Chess::EPDRunner::run(std::istream& suite, std::ostream& report)
+{
+	m_passed = 0;
+	m_failed = 0;
+	m_skipped = 0;
+	m_total_seconds = 0.0;
+	m_slowest = EPDResult();
+
+	//a few records per thread is enough to keep every worker busy.
+	BoundedQueue<std::pair<std::size_t, std::string>> records(4 * m_thread_count);
+
+	const auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> workers;
+	for (unsigned int i{ 0 }; i < m_thread_count; ++i) {
+
+		workers.emplace_back([this, &records, &report]() {
+
+			std::pair<std::size_t, std::string> record;
+			while (records.pop(record))
+				record_result(test_record(record.second, record.first), report);
+		});
+	}
+
+	//stream the suite rather than loading it, skipping blank lines and comments.
+	std::string line;
+	std::size_t index{ 0 };
+
+	while (std::getline(suite, line)) {
+
+		++index;
+
+		if (line.empty() || line[0] == '#' || line.find_first_not_of(" \t\r") == std::string::npos)
+			continue;
+
+		records.push(std::pair<std::size_t, std::string>(index, line));
+	}
+
+	records.close();
+
+	for (auto& worker : workers)
+		worker.join();
+
+	const double elapsed{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+	const std::size_t total{ m_passed + m_failed + m_skipped };
+
+	report << "\nEPD suite: " << total << " positions, " << m_passed << " passed, " << m_failed << " failed";
+
+	if (m_skipped > 0)
+		report << ", " << m_skipped << " not fully checked as their perft counts go deeper than " << m_max_perft_depth;
+
+	report << ".\n";
+
+	if (total > 0) {
+
+		report << "Total time " << elapsed << "s on " << m_thread_count << " threads, " << (total / elapsed) << " positions/s.\n"
+			<< "Time per position: " << (1000.0 * m_total_seconds / total) << "ms average, slowest line " << m_slowest.m_index
+			<< (m_slowest.m_id.empty() ? "" : " (" + m_slowest.m_id + ")") << " at " << (1000.0 * m_slowest.m_seconds) << "ms.\n";
+	}
+
+	return m_failed == 0;
+}
+
+const Chess::EPDResult Chess::EPDRunner::test_record(const std::string& record, const std::size_t index) const
+{
+	EPDResult result;
+	result.m_index = index;
+
+	const auto start = std::chrono::steady_clock::now();
+	std::ostringstream detail;
+
+	//a malformed record is a failure of that record, not of the whole run.
+	try {
+
+		EPD epd(record);
+		result.m_id = epd.get_id();
+
+		//this thread's own board.
+		Board board{ FEN(epd.get_fen()) };
+
+		for (const auto& operation : epd.get_operations()) {
+
+			const std::string& opcode{ operation.first };
+			const std::vector<std::string>& operands{ operation.second };
+
+			//perft counts are either 'Dn count' or 'perft n count'.
+			int depth{ 0 };
+			std::string expected;
+
+			if (opcode.size() > 1 && opcode[0] == 'D' && std::all_of(opcode.begin() + 1, opcode.end(), [](const char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; }) && operands.size() == 1) {
+
+				depth = std::stoi(opcode.substr(1));
+				expected = operands[0];
+			}
+			else if (opcode == "perft" && operands.size() == 2) {
+
+				depth = std::stoi(operands[0]);
+				expected = operands[1];
+			}
+
+			if (depth > 0) {
+
+				if (depth > m_max_perft_depth) {
+
+					result.m_skipped = true;
+					detail << "perft " << depth << " skipped. ";
+					continue;
+				}
+
+				const std::uint64_t nodes{ board.perft(depth) };
+
+				if (std::to_string(nodes) != expected) {
+
+					result.m_passed = false;
+					detail << "perft " << depth << " expected " << expected << " found " << nodes << ". ";
+				}
+				else {
+
+					detail << "perft " << depth << " ok. ";
+				}
+			}
+			else if ((opcode == "bm" || opcode == "am") && !operands.empty()) {
+
+				Search search(board);
+				const SearchResult searched{ search.search(m_search_depth) };
+
+				//resolve the answers against the legal moves, the search leaves the board as it found it.
+				board.generate_legal_moves();
+
+				bool listed{ false };
+				for (const auto& san : operands) {
+
+					const auto answer = board.find_san_move(san);
+
+					if (!answer.first) {
+
+						result.m_passed = false;
+						detail << opcode << " " << san << " is not a legal move. ";
+					}
+					else if (answer.second.m_from == searched.m_best_move.m_from && answer.second.m_to == searched.m_best_move.m_to && answer.second.m_promotion == searched.m_best_move.m_promotion) {
+
+						listed = true;
+					}
+				}
+
+				//a best move must be one of those listed, an avoid move must be none of them.
+				if (listed != (opcode == "bm")) {
+
+					result.m_passed = false;
+					detail << opcode << " failed, found " << board.convert_move_to_notation(searched.m_best_move) << ". ";
+				}
+				else {
+
+					detail << opcode << " ok. ";
+				}
+			}
+		}
+	}
+	catch (std::exception& e) {
+
+		result.m_passed = false;
+		detail << "Error: " << e.what();
+	}
+
+	result.m_detail = detail.str();
+	result.m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+void Chess::EPDRunner::record_result(const EPDResult& result, std::ostream& report)
+{
+	std::lock_guard<std::mutex> lock(m_results_mutex);
+
+	if (!result.m_passed)
+		++m_failed;
+	else if (result.m_skipped)
+		++m_skipped;
+	else
+		++m_passed;
+	m_total_seconds += result.m_seconds;
+
+	if (result.m_seconds >= m_slowest.m_seconds)
+		m_slowest = result;
+
+	//only failures are worth a line of their own on a suite of thousands of positions.
+	if (!result.m_passed)
+		report << "FAIL line " << result.m_index << (result.m_id.empty() ? "" : " (" + result.m_id + ")") << ": " << result.m_detail << "(" << (1000.0 * result.m_seconds) << "ms)\n";
+}
@@ -0,0 +1,68 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to run an EPD test-suite across a pool of threads. The suite is streamed a line at a time into a bounded queue, and each worker thread takes
+records from the queue and builds its own board for them, so no board is ever shared between threads. Each record is checked against its perft counts
+('D1'...'Dn' or 'perft n') and its best/avoid move answers ('bm'/'am'), and the run is reported as pass/fail counts, positions per second and time per position. A record with a perft count deeper than the limit is counted as
+neither, as it wasn't fully checked.
+*/
+
+#ifndef __EPDRUNNER_HEADER
+#define __EPDRUNNER_HEADER
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <mutex>
+#include <cstdint>
+
+namespace Chess {
+
+	struct EPDResult
+	{
+		std::size_t m_index{ 0 };
+		std::string m_id;
+		bool m_passed{ true };
+		//a perft count deeper than the runner's limit wasn't checked, so the record hasn't passed even if nothing failed.
+		bool m_skipped{ false };
+		//what was checked, and for failures what was expected and found.
+		std::string m_detail;
+		double m_seconds{ 0.0 };
+	};
+
+	class EPDRunner
+	{
+	public:
+		EPDRunner(const unsigned int thread_count, const int search_depth, const int max_perft_depth);
+		~EPDRunner() {}
+
+		//run every record of the suite, failures are reported as they happen and a summary at the end. Returns true if every record passed.
+		const bool run(std::istream& suite, std::ostream& report);
+
+	private:
+
+		const EPDResult test_record(const std::string& record, const std::size_t index) const;
+		void record_result(const EPDResult& result, std::ostream& report);
+
+		unsigned int m_thread_count;
+
+		//depth used to answer bm/am operations.
+		int m_search_depth;
+
+		//perft counts deeper than this are skipped, deep perft can take minutes per position.
+		int m_max_perft_depth;
+
+		//results are gathered from every worker.
+		std::mutex m_results_mutex;
+		std::size_t m_passed{ 0 };
+		std::size_t m_failed{ 0 };
+		std::size_t m_skipped{ 0 };
+		double m_total_seconds{ 0.0 };
+		EPDResult m_slowest;
+	};
+}
+
+#endif
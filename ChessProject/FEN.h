@@ -27,6 +27,9 @@ public:
 	FEN(const std::string game_configuration);
 	~FEN() {}
 
+	//the starting position of standard chess.
+	static constexpr const char* standard_position{ "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1" };
+
 	bool find_matching_expression();
 
 	//extract information from our correctly parsed regex.
@@ -0,0 +1,46 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This file holds the constants that differ between the two sides, keyed on a compile-time Faction. Move generation, attack tests and making moves are templated on
+the side to move and look these up, so the direction of a pawn, the rows it starts and promotes on and the castling permissions are constants in the generated
+code, rather than branches on the faction in every loop. The faction is dispatched on once, at the top of a node.
+*/
+
+#ifndef __FACTIONTRAITS_HEADER
+#define __FACTIONTRAITS_HEADER
+
+#include "BoardBase.h"
+#include "Tile.h"
+
+namespace Chess {
+
+	template<Faction Side>
+	struct FactionTraits
+	{
+		static_assert(Side != Faction::NonAligned, "Only the two sides have traits!");
+
+		using TileVector = BoardBase<10, 12, Tile>::TileVector;
+		using Squares = BoardBase<10, 12, Tile>::Squares;
+
+		static constexpr bool is_white{ Side == Faction::White };
+		static constexpr Faction enemy{ is_white ? Faction::Black : Faction::White };
+
+		//indexes anything kept per side, white (0) or black (1).
+		static constexpr int index{ is_white ? 0 : 1 };
+
+		static constexpr int forward{ is_white ? TileVector::north : TileVector::south };
+
+		//rows of the visible board, counted from the top (rank 8) as squares are.
+		static constexpr int pawn_start_row{ is_white ? Squares::game_board_y - 2 : 1 };
+		static constexpr int promotion_row{ is_white ? 0 : Squares::game_board_y - 1 };
+
+		//the castling permission bits, K = 1, Q = 2, k = 4, q = 8, as in Board::get_castle_permissions.
+		static constexpr int king_side_castle{ is_white ? 1 : 4 };
+		static constexpr int queen_side_castle{ is_white ? 2 : 8 };
+	};
+}
+
+#endif
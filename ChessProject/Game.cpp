@@ -1,12 +1,38 @@
 #include "Game.h"
 
-Chess::Game::Game(const FEN& game_state) : m_handler(m_board)
+Chess::Game::Game(const FEN& game_state) : Game(game_state, Faction::NonAligned) {}
+
+Chess::Game::Game(const FEN& game_state, const Faction computer_faction) : m_computer_faction(computer_faction), m_input(std::cin), m_handler(m_board)
 {
 	m_board = std::make_shared<Board>(game_state);
 	m_handler = InputHandler(m_board);
+
+	if (m_computer_faction != Faction::NonAligned)
+		m_table = std::make_unique<TranspositionTable>();
+
+	m_human_move_time = std::chrono::steady_clock::now();
+
 	play();
 }
 
+Chess::Game::Game(const FEN& game_state, std::istream& script) : m_input(script), m_scripted(true), m_handler(m_board, false)
+{
+	m_board = std::make_shared<Board>(game_state);
+	m_handler = InputHandler(m_board, false);
+
+	play();
+}
+
+Chess::Game::~Game()
+{
+	//a game may end while the computer is pondering.
+	if (m_ponder_thread.joinable()) {
+
+		m_ponder_search->stop();
+		m_ponder_thread.join();
+	}
+}
+
 void Chess::Game::checkmate()
 {
 	std::cout << "\nGame over! Checkmate! " << m_board->get_enemy().get_name() << " is victorious!\n";
@@ -17,6 +43,11 @@ void Chess::Game::stalemate()
 	std::cout << "\nGame over! Stalemate...\n";
 }
 
+void Chess::Game::repetition()
+{
+	std::cout << "\nGame over! Draw by threefold repetition...\n";
+}
+
 void Chess::Game::resign()
 {
 	std::cout << m_board->get_player().get_name() << " has resigned! " << m_board->get_enemy().get_name() << " is victorious!\n";
@@ -55,6 +86,8 @@ void Chess::Game::end_game(const BoardState state)
 		checkmate();
 	else if (state == BoardState::Stalemate)
 		stalemate();
+	else if (state == BoardState::Repetition)
+		repetition();
 	else
 		std::cout << "Game ended - unknown lose-state.\n";
 
@@ -63,33 +96,57 @@ void Chess::Game::end_game(const BoardState state)
 
 void Chess::Game::play()
 {
-	std::cout << "\n\nThe game has begun: Please enter 'help' for a list of commands.\n\n";
+	if (!m_scripted)
+		std::cout << "\n\nThe game has begun: Please enter 'help' for a list of commands.\n\n";
+
 	//check for quits and mates.
 	while (!is_game_over())
 	{
-		//swap the players around
-		m_board->rotate_players();
 		m_board->determine_current_check_state();
 		m_board->assign_piece_pins();
 		m_board->generate_composite_movelist();
-		m_board->pretty_print_board();
 
 		//take input if there is no mates.
 		BoardState state = m_board->state();
+
+		//a script is run at full speed, so its board is only drawn at the end.
+		if (!m_scripted) {
+
+			if (state == BoardState::Legal)
+				m_status += m_board->get_player().get_name() + " to play" + (m_board->get_current_check_state() ? ", in check!" : "!");
+
+			print_board();
+		}
+
 		if (state == BoardState::Legal) {
 
-			std::cout << m_board->get_player().get_name() << " to play! " << m_board->get_enemy().get_name() << " is the enemy...\n";
-			if (m_board->get_current_check_state())
-				std::cout << "You are in Check!\n";
+			if (m_board->get_player_faction() == m_computer_faction) {
+
+				play_computer_move();
+			}
+			else {
+
+				//think on the human's time.
+				start_pondering();
+
+				//let the input handler deal with input.
+				m_handler.listen(m_input);
+
+				//if the input resulted in a promotion, let the input handler deal with it.
+				if (m_board->is_promotion()) {
 
-			//let the input handler deal with input.
-			m_handler.listen(std::cin);
+					m_handler.get_promotion(m_input);
+				}
 
-			//if the input resulted in a promotion, let the input handler deal with it.
-			if (m_board->is_promotion()) {
+				//the input was echoed beneath the board.
+				m_renderer.invalidate();
 
-				m_handler.get_promotion();
+				m_human_move_time = std::chrono::steady_clock::now();
 			}
+
+			//swap the players around, the board always holds the player to move as m_player.
+			if (m_handler.get_handler_state() == InputHandlerState::Active)
+				m_board->rotate_players();
 		}
 		else {
 
@@ -97,5 +154,90 @@ void Chess::Game::play()
 			break;
 		}
 	}
+
+	if (m_scripted) {
+
+		m_board->determine_current_check_state();
+		m_board->assign_piece_pins();
+		m_board->generate_composite_movelist();
+		print_board();
+	}
 }
 
+void Chess::Game::print_board()
+{
+	m_renderer.redraw(m_board->get_movelist_cells(), m_status, std::cout);
+	m_status.clear();
+}
+
+
+void Chess::Game::play_computer_move()
+{
+	std::pair<bool, SearchResult> pondered{ finish_pondering() };
+	SearchResult result{ pondered.second };
+
+	if (!pondered.first) {
+
+		SearchLimits limits;
+		limits.m_move_time = computer_move_time;
+
+		Search search(*m_board, m_table.get());
+		result = search.search(limits);
+	}
+
+	const auto reply_time{ std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_human_move_time) };
+
+	//the search consumes the board's movelist, so rebuild it before executing the move.
+	m_board->generate_legal_moves();
+	m_board->find_and_execute_move(result.m_best_move);
+
+	//the move is shown beneath the next board, so the board can be redrawn in place.
+	m_status = m_board->get_player().get_name() + " plays " + m_board->convert_move_to_notation(result.m_best_move) + " (" + std::to_string(reply_time.count())
+		+ "ms" + (pondered.first ? ", pondered). " : "). ");
+
+	m_expected_move = result.m_ponder_move;
+}
+
+void Chess::Game::start_pondering()
+{
+	if ((m_computer_faction == Faction::NonAligned) || (m_expected_move.m_from == 0))
+		return;
+
+	//a packed copy of the position is cheap to make, it takes on the positions since the last capture or pawn move so the search sees repetitions.
+	m_ponder_board = std::make_unique<Board>(m_board->encode());
+	m_ponder_board->copy_repetition_history(*m_board);
+	m_ponder_board->generate_legal_moves();
+
+	if (!m_ponder_board->find_and_execute_move(m_expected_move))
+		return;
+
+	m_ponder_board->rotate_players();
+	m_ponder_hash = m_ponder_board->get_hash();
+
+	SearchLimits limits;
+	limits.m_move_time = computer_move_time;
+	limits.m_ponder = true;
+
+	m_ponder_search = std::make_unique<Search>(*m_ponder_board, m_table.get());
+	m_ponder_thread = std::thread([this, limits]() { m_ponder_result = m_ponder_search->search(limits); });
+}
+
+const std::pair<bool, Chess::SearchResult> Chess::Game::finish_pondering()
+{
+	if (!m_ponder_thread.joinable())
+		return std::pair<bool, SearchResult>(false, SearchResult());
+
+	//the same position means the human played the expected move, the search carries on with the time spent pondering counted.
+	const bool ponder_hit{ m_board->get_hash() == m_ponder_hash };
+
+	if (ponder_hit)
+		m_ponder_search->ponderhit();
+	else
+		m_ponder_search->stop();
+
+	m_ponder_thread.join();
+	m_ponder_search.reset();
+	m_ponder_board.reset();
+
+	return std::pair<bool, SearchResult>(ponder_hit && (m_ponder_result.m_best_move.m_from != 0), m_ponder_result);
+}
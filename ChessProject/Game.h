@@ -5,7 +5,8 @@ Email: Christopher.Ryder-2@student.manchester.ac.uk
 
 Remit:
 This class serves to represent an overall 'manager' of the game and will interface with the input handler and the board. This class determines the lifespan
-of the game.
+of the game. Either player may be played by the computer, which ponders the human's expected reply on a worker thread while waiting for their input.
+A game can also be played from a script of commands, in which case the board is only drawn once the script has finished.
 */
 
 #ifndef __GAME_HEADER
@@ -14,10 +15,16 @@ of the game.
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <memory>
+#include <thread>
+#include <chrono>
 
 #include "FEN.h"
 #include "Board.h"
+#include "BoardRenderer.h"
 #include "Player.h"
+#include "Search.h"
+#include "TranspositionTable.h"
 
 #include "InputHandler.h"
 
@@ -27,12 +34,19 @@ namespace Chess {
 	{
 	public:
 		Game(const FEN& game_state);
+		//the computer plays the given faction, Faction::NonAligned for a game between two humans.
+		Game(const FEN& game_state, const Faction computer_faction);
+		//both players' commands are read from the script, one per line, as they would be typed.
+		Game(const FEN& game_state, std::istream& script);
+		~Game();
 
 		void play();
 
 		inline const bool try_execute_move(const int from, const int to) const { return m_board->find_and_execute_move(from, to); }
 		inline const bool try_execute_undo_move() const { return m_board->execute_undo_command(); }
 
+		inline const std::size_t get_commands_read() const { return m_handler.get_commands_read(); }
+
 	private:
 
 		void end_game(const BoardState state);
@@ -40,10 +54,46 @@ namespace Chess {
 		void quit();
 		void checkmate();
 		void stalemate();
+		void repetition();
 
 		const bool is_game_over();
 		bool m_game_ended{ false };
 
+		//the computer's turn, using the ponder search if it guessed the human's move.
+		void play_computer_move();
+
+		//search the position after the human's expected move on a copy of the board, so the human's input can change the real board meanwhile.
+		void start_pondering();
+		//true if the human played the expected move, the search then finishes as a normal search and its result is returned.
+		const std::pair<bool, SearchResult> finish_pondering();
+
+		Faction m_computer_faction{ Faction::NonAligned };
+		std::unique_ptr<TranspositionTable> m_table;
+
+		//the human's reply the computer expects, from its last search.
+		Move m_expected_move;
+		std::unique_ptr<Board> m_ponder_board;
+		std::unique_ptr<Search> m_ponder_search;
+		std::thread m_ponder_thread;
+		SearchResult m_ponder_result;
+		std::uint64_t m_ponder_hash{ 0 };
+
+		//draw the board with the player's pieces decorated, and the status beneath it. only the tiles and status that changed are redrawn if nothing else
+		//has been written since the last board.
+		void print_board();
+		BoardRenderer m_renderer;
+		//what has happened since the last board was drawn, and whose turn it is.
+		std::string m_status;
+
+		//the human's move is timed from here, to measure how quickly the computer replies.
+		std::chrono::steady_clock::time_point m_human_move_time;
+
+		static constexpr std::chrono::milliseconds computer_move_time{ 2000 };
+
+		//where the human's commands come from, and whether they're a script rather than a player.
+		std::istream& m_input;
+		bool m_scripted{ false };
+
 		//share the board with the input_handler
 		std::shared_ptr<Board> m_board;
 
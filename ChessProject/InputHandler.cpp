@@ -1,32 +1,56 @@
 #include "InputHandler.h"
 
+#include "BoardRenderer.h"
 
-Chess::InputHandler::InputHandler(std::shared_ptr<Board> board_handle) : m_board_handle(board_handle) {}
+#include <algorithm>
+#include <cctype>
+
+namespace {
+
+	//a coordinate is two word charachters, checked against the board when it is converted.
+	const bool is_coordinate(const std::string_view token)
+	{
+		return (token.size() == 2) && std::all_of(token.begin(), token.end(), [](unsigned char c) { return std::isalnum(c) || c == '_'; });
+	}
+}
+
+Chess::InputHandler::InputHandler(std::shared_ptr<Board> board_handle, const bool prompting) : m_board_handle(board_handle), m_prompting(prompting) {}
 
 void Chess::InputHandler::listen(std::istream& stream)
 {
-	std::cout << "Please enter a move: ";
+	//take commands until one is successful, a loop rather than recursion so any amount of rejected input is fine.
+	for (;;) {
+
+		if (m_prompting)
+			std::cout << "Please enter a move: ";
+
+		if (!std::getline(stream, m_input, '\n')) {
+
+			m_state = InputHandlerState::Quit;
+			return;
+		}
 
-	std::string input;
-	std::getline(stream, input, '\n');
+		++m_commands_read;
 
-	//transform the input to all lower case using a lambda
-	std::transform(input.begin(), input.end(), input.begin(),
-		[](unsigned char c) { return std::tolower(c); });
+		//transform the input to all lower case using a lambda
+		std::transform(m_input.begin(), m_input.end(), m_input.begin(),
+			[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
 
-	//if the dispatch was not successful, take another command.
-	if (!dispatch_command(input))
-		listen(std::cin);
+		if (dispatch_command(m_input))
+			return;
+	}
 }
 
-void Chess::InputHandler::get_promotion()
+void Chess::InputHandler::get_promotion(std::istream& stream)
 {
-	std::cout << "Please enter the initial (case-sensitive!) of the piece type you wish to promote to:\n";
+	if (m_prompting)
+		std::cout << "Please enter the initial (case-sensitive!) of the piece type you wish to promote to:\n";
 
-	
 	std::string promotion;
 
-	while (std::getline(std::cin, promotion, '\n')) {
+	while (std::getline(stream, promotion, '\n')) {
+
+		++m_commands_read;
 
 		if (promotion.length() != 1) {
 
@@ -38,7 +62,7 @@ void Chess::InputHandler::get_promotion()
 
 			if (found != std::string::npos) {
 				m_board_handle->promote(promotion[found]);
-				break;
+				return;
 			}
 			else {
 				std::cout << "Invalid token entered! Please enter one of either ";
@@ -46,6 +70,51 @@ void Chess::InputHandler::get_promotion()
 			}
 		}
 	}
+
+	//the input ran out before the pawn was promoted.
+	m_state = InputHandlerState::Quit;
+}
+
+const Chess::Command Chess::InputHandler::parse_command(std::string_view command_input)
+{
+	const std::size_t first{ command_input.find_first_not_of(" \t\r") };
+
+	if (first == std::string_view::npos)
+		return Command();
+
+	command_input = command_input.substr(first, command_input.find_last_not_of(" \t\r") - first + 1);
+
+	Command command;
+
+	if (command_input.size() == 5 && command_input[2] == ';' && is_coordinate(command_input.substr(0, 2)) && is_coordinate(command_input.substr(3, 2))) {
+
+		command.m_type = CommandType::Move;
+		command.m_from = command_input.substr(0, 2);
+		command.m_to = command_input.substr(3, 2);
+	}
+	else if (command_input.size() == 3 && command_input[2] == '?' && is_coordinate(command_input.substr(0, 2))) {
+
+		command.m_type = CommandType::ShowMoves;
+		command.m_from = command_input.substr(0, 2);
+	}
+	else if (command_input == "undo") {
+
+		command.m_type = CommandType::Undo;
+	}
+	else if (command_input == "help") {
+
+		command.m_type = CommandType::Help;
+	}
+	else if (command_input == "resign") {
+
+		command.m_type = CommandType::Resign;
+	}
+	else if (command_input == "quit") {
+
+		command.m_type = CommandType::Quit;
+	}
+
+	return command;
 }
 
 //if you ever wanted to see why medium-compact brace notation looks bad, check this function!
@@ -53,23 +122,30 @@ bool Chess::InputHandler::dispatch_command(const std::string& command_input)
 {
 	bool stop_listening{ false };
 
-	//need to attempt to look up the command in the map, don't see how this is easily possible for the input because its so varied. I also struggle to pass parameters to command.
-	if (try_execute_move(command_input)) {
+	const Command command{ parse_command(command_input) };
+
+	switch (command.m_type)
+	{
+	case CommandType::Move:
 
 		//if the move was 'successfull' the handler can stop listening to the current player.
-		stop_listening = true;
-	}
-	else if (try_execute_print_piece_moves(command_input)) {
+		stop_listening = try_execute_move(command);
+		break;
+
+	case CommandType::ShowMoves:
 
 		//asking for the moves to be printed doesn't terminate a turn.
+		try_execute_print_piece_moves(command);
 		stop_listening = false;
-	}
-	else if (command_input == "undo") {
+		break;
+
+	case CommandType::Undo:
 
 		//undoing a turn terminates the move for that player, if it was successful.
 		stop_listening = m_board_handle->execute_undo_command();
-	}
-	else if (command_input == "help") {
+		break;
+
+	case CommandType::Help:
 
 		std::cout << "\nHelp:\n"
 			<< "To enter a move please type it in the format: 'a1;a2' (Two chessboard coordinates separated by a semi-colon).\n"
@@ -80,97 +156,71 @@ bool Chess::InputHandler::dispatch_command(const std::string& command_input)
 
 		//asking for help doesn't terminate a move.
 		stop_listening = false;
-	}
-	else if (command_input == "quit") {
+		break;
+
+	case CommandType::Quit:
 
 		m_state = InputHandlerState::Quit;
 		stop_listening = true;
-	}
-	else if (command_input == "resign") {
+		break;
+
+	case CommandType::Resign:
 
 		m_state = InputHandlerState::Resign;
 		stop_listening = true;
-	}
-	else {
+		break;
+
+	default:
 
 		std::cout << "Command was not executed. Type 'help' for help.\n";
 		stop_listening = false;
+		break;
 	}
 
 	return stop_listening;
 }
 
-bool Chess::InputHandler::try_execute_move(const std::string& command_input)
+bool Chess::InputHandler::try_execute_move(const Command& command)
 {
-	bool command_success{ false };
-
-	if (std::regex_match(command_input, m_move_regex))
-	{
-		//this is a valid move command.
-		bool move_success{ false };
-
-		std::smatch matches;
-		std::regex_search(command_input, matches, m_move_regex);
+	auto from_iterator = m_board_handle->convert_coordinate_to_position(command.m_from);
+	auto to_iterator = m_board_handle->convert_coordinate_to_position(command.m_to);
 
-		std::string algebraic_from(matches[1]);
-		std::string algebraic_to(matches[2]);
+	//both tokens have the shape of a coordinate, but may be off the board.
+	if (!from_iterator.first || !to_iterator.first) {
 
-		auto from_iterator = m_board_handle->convert_coordinate_to_position(algebraic_from);
-
-		if (from_iterator.first)
-		{
-			auto to_iterator = m_board_handle->convert_coordinate_to_position(algebraic_to);
-
-			if (to_iterator.first)
-			{
-				int position_from = from_iterator.second;
-				int position_to = to_iterator.second;
-
-				bool move_success = m_board_handle->find_and_execute_move(position_from, position_to);
+		std::cout << "Command was not executed. Type 'help' for help.\n";
+		return false;
+	}
 
-				if (!move_success)
-					std::cout << "Invalid Move: [" << algebraic_from << ", " << algebraic_to << "].\n";
-				
-				command_success = move_success;
-			}
-		}
+	bool move_success = m_board_handle->find_and_execute_move(from_iterator.second, to_iterator.second);
 
-	}
+	if (!move_success)
+		std::cout << "Invalid Move: [" << command.m_from << ", " << command.m_to << "].\n";
 
-	return command_success;
+	return move_success;
 }
 
-bool Chess::InputHandler::try_execute_print_piece_moves(const std::string& command_input)
+bool Chess::InputHandler::try_execute_print_piece_moves(const Command& command)
 {
-	bool command_success{ false };
-
-	if (std::regex_match(command_input, m_show_move_regex))
-	{
-		//this is a valid show move command.
-		bool move_success{ false };
+	auto from_iterator = m_board_handle->convert_coordinate_to_position(command.m_from);
 
-		std::smatch matches;
-		std::regex_search(command_input, matches, m_show_move_regex);
+	if (!from_iterator.first) {
 
-		std::string algebraic_from(matches[1]);
-
-		auto from_iterator = m_board_handle->convert_coordinate_to_position(algebraic_from);
-
-		if (from_iterator.first)
-		{
-
-			int position_from = from_iterator.second;
+		std::cout << "Command was not executed. Type 'help' for help.\n";
+		return false;
+	}
 
-			bool move_success = m_board_handle->find_and_execute_pretty_print(position_from);
+	const auto cells = m_board_handle->get_piece_move_cells(from_iterator.second);
 
-			if (!move_success)
-				std::cout << "Invalid Selection: [" << algebraic_from << "] has no moves!\n";
+	if (!cells.first) {
 
-			command_success = move_success;
-		}
+		std::cout << "Invalid Selection: [" << command.m_from << "] has no moves!\n";
+		return false;
 	}
 
-	return command_success;
-}
-
+	//the moves are shown between commands, always as a whole frame, so one renderer serves every handler.
+	static BoardRenderer renderer;
+	renderer.render(cells.second, "", std::cout);
 
+	return true;
+}
@@ -5,14 +5,15 @@ Email: Christopher.Ryder-2@student.manchester.ac.uk
 
 Remit:
 This class serves to try and decouple user input from the game/board methods! This would allow for easy porting to other systems, such as a GUI, e.g using SFML or Universal Chess Interface.
+Commands are read from any stream, so a game can also be driven by a script of commands rather than a player. A scripted handler doesn't prompt for input.
 */
 
 #ifndef __GAMEINPUTHANDLER_HEADER
 #define __GAMEINPUTHANDLER_HEADER
 
 #include <string>
-#include <regex>
-#include <sstream>
+#include <string_view>
+#include <istream>
 
 #include "Board.h"
 
@@ -25,21 +26,44 @@ namespace Chess {
 		Quit
 	};
 
+	enum class CommandType
+	{
+		Move,
+		ShowMoves,
+		Undo,
+		Help,
+		Resign,
+		Quit,
+		Unknown
+	};
+
+	//a command split into its parts, the coordinates view the input line they were parsed from.
+	struct Command
+	{
+		CommandType m_type{ CommandType::Unknown };
+		std::string_view m_from;
+		std::string_view m_to;
+	};
+
 	class InputHandler
 	{
 	public:
-		InputHandler(std::shared_ptr<Board> board_handle);
+		InputHandler(std::shared_ptr<Board> board_handle, const bool prompting = true);
 		~InputHandler() {}
 
+		//read commands until one ends the player's turn. running out of input quits the game.
 		void listen(std::istream& stream);
-		void get_promotion();
+		void get_promotion(std::istream& stream);
 		bool dispatch_command(const std::string& command_input);
 
 		const InputHandlerState get_handler_state() const { return m_state; }
+		const std::size_t get_commands_read() const { return m_commands_read; }
+
+		//the grammar is small enough to tokenize by hand: 'a1;a2', 'a1?' or a keyword, surrounding whitespace ignored.
+		static const Command parse_command(std::string_view command_input);
 
-		//need to test moves which require regexes explicitly, i think. don't think there is an easy way to forward parameters with commands?
-		bool try_execute_move(const std::string& command_input);
-		bool try_execute_print_piece_moves(const std::string& command_input);
+		bool try_execute_move(const Command& command);
+		bool try_execute_print_piece_moves(const Command& command);
 
 	private:
 
@@ -47,15 +71,12 @@ namespace Chess {
 
 		std::shared_ptr<Board> m_board_handle;
 
-		//is the command for a move or to show the moves?
-		std::regex m_move_regex{ R"((\w{2})\;(\w{2}))" };
-		std::regex m_show_move_regex{ R"((\w{2})\?)" };
+		bool m_prompting{ true };
+		std::size_t m_commands_read{ 0 };
 
-		std::string m_undo_query{ "undo" };
-		std::string m_pieces_query{ "?" };
-		std::string m_resign_query{ "resign" };
-		std::string m_quit_query{ "quit" };
+		//reused for every line read, so reading a command doesn't allocate.
+		std::string m_input;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,9 +1,26 @@
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <sstream>
 
+#include <fstream>
+#include <thread>
+#include <chrono>
+#include <random>
+
 #include "Game.h"
 #include "FEN.h"
+#include "EPD.h"
+#include "EPDRunner.h"
+#include "Match.h"
+#include "MappedFile.h"
+#include "PackedPosition.h"
+#include "PGNReplayer.h"
+#include "Board.h"
+#include "BoardRenderer.h"
+#include "Search.h"
+#include "UCI.h"
+#include "VariationTree.h"
 
 const int get_int_in_range(int min, int max)
 {
@@ -49,8 +66,721 @@ void game_from_fen()
 	}
 }
 
-int main()
+//usage: ChessProject epd <suite.epd> [threads] [search depth] [max perft depth]
+int run_epd_suite(int argc, char* argv[])
+{
+	if (argc < 3) {
+
+		std::cout << "Usage: epd <suite.epd> [threads] [search depth] [max perft depth]\n";
+		return 1;
+	}
+
+	std::ifstream suite(argv[2]);
+
+	if (!suite) {
+
+		std::cout << "Could not open EPD suite: " << argv[2] << "\n";
+		return 1;
+	}
+
+	const unsigned int threads{ (argc > 3) ? static_cast<unsigned int>(std::stoi(argv[3])) : std::thread::hardware_concurrency() };
+	const int search_depth{ (argc > 4) ? std::stoi(argv[4]) : 4 };
+	const int max_perft_depth{ (argc > 5) ? std::stoi(argv[5]) : 6 };
+
+	Chess::EPDRunner runner(threads, search_depth, max_perft_depth);
+	return runner.run(suite, std::cout) ? 0 : 1;
+}
+
+//usage: ChessProject pgn <archive.pgn> [threads]
+int replay_pgn_archive(int argc, char* argv[])
+{
+	if (argc < 3) {
+
+		std::cout << "Usage: pgn <archive.pgn> [threads]\n";
+		return 1;
+	}
+
+	const unsigned int threads{ (argc > 3) ? static_cast<unsigned int>(std::stoi(argv[3])) : std::thread::hardware_concurrency() };
+
+	try {
+
+		MappedFile archive(argv[2]);
+
+		Chess::PGNReplayer replayer(threads);
+		return replayer.run(archive.view(), std::cout) ? 0 : 1;
+	}
+	catch (std::exception& e) {
+
+		std::cout << "Error: " << e.what() << "\n";
+		return 1;
+	}
+}
+
+//usage: ChessProject match <openings.epd> <games.pgn> [games] [threads] [time control, e.g 10+0.1] [first engine depth] [second engine depth]
+//a depth of 0 lets the clock decide.
+int run_match(int argc, char* argv[])
+{
+	if (argc < 4) {
+
+		std::cout << "Usage: match <openings.epd> <games.pgn> [games] [threads] [time control, e.g 10+0.1] [first engine depth] [second engine depth]\n";
+		return 1;
+	}
+
+	std::ifstream openings_file(argv[2]);
+	std::ofstream pgn(argv[3]);
+
+	if (!openings_file || !pgn) {
+
+		std::cout << "Could not open " << (!openings_file ? argv[2] : argv[3]) << "\n";
+		return 1;
+	}
+
+	std::vector<std::string> openings;
+	std::string line{};
+
+	while (std::getline(openings_file, line)) {
+
+		if (line.find_first_not_of(" \t\r") != std::string::npos)
+			openings.push_back(EPD(line).get_fen());
+	}
+
+	Chess::MatchSettings settings;
+	settings.m_games = (argc > 4) ? std::stoi(argv[4]) : settings.m_games;
+	settings.m_threads = (argc > 5) ? static_cast<unsigned int>(std::stoi(argv[5])) : std::thread::hardware_concurrency();
+
+	if (argc > 6) {
+
+		const std::string time_control{ argv[6] };
+		const std::size_t plus{ time_control.find('+') };
+
+		settings.m_time_control.m_base = std::chrono::milliseconds(static_cast<long long>(std::stod(time_control.substr(0, plus)) * 1000));
+		settings.m_time_control.m_increment = std::chrono::milliseconds((plus != std::string::npos) ? static_cast<long long>(std::stod(time_control.substr(plus + 1)) * 1000) : 0);
+	}
+
+	settings.m_first.m_depth = (argc > 7) ? std::stoi(argv[7]) : 0;
+	settings.m_second.m_depth = (argc > 8) ? std::stoi(argv[8]) : 0;
+
+	Chess::Match match(settings, std::move(openings));
+	match.run(pgn, std::cout);
+	return 0;
+}
+
+//usage: ChessProject bench [depth]
+//walk the game tree of the standard perft positions by make/unmake on the Board, with and without bulk counting the last ply, and by copy-make on a Position,
+//and compare. then search them one ply deeper
+//and count the moves the staged move generation saved.
+int run_benchmark(int argc, char* argv[])
 {
+	const int depth{ (argc > 2) ? std::stoi(argv[2]) : 4 };
+
+	const char* positions[] = {
+		FEN::standard_position,
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+		"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+		"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10"
+	};
+
+	double make_unmake_seconds{ 0.0 };
+	double bulk_count_seconds{ 0.0 };
+	double copy_make_seconds{ 0.0 };
+	std::uint64_t total_nodes{ 0 };
+	bool all_match{ true };
+
+	std::cout << "Position size: " << sizeof(Chess::Position) << " bytes.\n";
+
+	for (const char* position : positions) {
+
+		Chess::Board board{ FEN(position) };
+		const Chess::Position copy{ board.copy_position() };
+
+		auto start{ std::chrono::steady_clock::now() };
+		const std::uint64_t make_unmake_nodes{ board.perft(depth, false) };
+		const double make_unmake_time{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+		start = std::chrono::steady_clock::now();
+		const std::uint64_t bulk_count_nodes{ board.perft(depth) };
+		const double bulk_count_time{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+		start = std::chrono::steady_clock::now();
+		const std::uint64_t copy_make_nodes{ copy.perft(depth) };
+		const double copy_make_time{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+		const bool match{ (make_unmake_nodes == bulk_count_nodes) && (make_unmake_nodes == copy_make_nodes) };
+
+		all_match = all_match && match;
+		make_unmake_seconds += make_unmake_time;
+		bulk_count_seconds += bulk_count_time;
+		copy_make_seconds += copy_make_time;
+		total_nodes += make_unmake_nodes;
+
+		std::cout << position << "\n"
+			<< "  make/unmake: " << make_unmake_nodes << " nodes in " << make_unmake_time << "s.\n"
+			<< "  bulk count:  " << bulk_count_nodes << " nodes in " << bulk_count_time << "s.\n"
+			<< "  copy-make:   " << copy_make_nodes << " nodes in " << copy_make_time << "s." << (match ? "\n" : " MISMATCH!\n");
+	}
+
+	//the bulk counted and copy-make walks count the last ply without making its moves.
+	std::cout << "Total " << total_nodes << " nodes at depth " << depth << ": make/unmake " << static_cast<std::uint64_t>(total_nodes / make_unmake_seconds)
+		<< " nodes/s, bulk count " << static_cast<std::uint64_t>(total_nodes / bulk_count_seconds)
+		<< " nodes/s, copy-make " << static_cast<std::uint64_t>(total_nodes / copy_make_seconds) << " nodes/s.\n";
+
+	//replay a random game from the standard position, by generating the movelist at every ply as a game does and by replaying its moves straight onto the
+	//board, and compare the positions they reach.
+	std::vector<Chess::Move> game;
+	{
+		Chess::Board board{ FEN(FEN::standard_position) };
+		std::mt19937 random;
+
+		for (int ply{ 0 }; ply < 200; ++ply) {
+
+			board.generate_legal_moves();
+			const std::vector<Chess::MoveList> moves{ board.take_move_list() };
+
+			if (moves.empty())
+				break;
+
+			const Chess::MoveList& movelist{ moves[std::uniform_int_distribution<std::size_t>(0, moves.size() - 1)(random)] };
+			const auto& command{ *std::next(movelist.begin(), std::uniform_int_distribution<std::size_t>(0, movelist.size() - 1)(random)) };
+
+			Chess::Move move{ movelist.get_origin(), command->get_to(), 0 };
+			if (command->is_promotion())
+				move.m_promotion = (board.get_player_faction() == Chess::Faction::White) ? 'Q' : 'q';
+
+			game.push_back(move);
+			board.replay_move(move, true);
+		}
+	}
+
+	//only the replay is timed, the board is made once and the game undone between replays.
+	const int replays{ 1000 };
+	std::uint64_t generated_hash{ 0 };
+	std::uint64_t replayed_hash{ 0 };
+	double generated_time{ 0.0 };
+	double replayed_time{ 0.0 };
+
+	Chess::Board generated_board{ FEN(FEN::standard_position) };
+	Chess::Board replayed_board{ FEN(FEN::standard_position) };
+
+	for (int i{ 0 }; i < replays; ++i) {
+
+		auto start{ std::chrono::steady_clock::now() };
+		for (const Chess::Move& move : game) {
+
+			generated_board.generate_legal_moves();
+			generated_board.find_and_execute_move(move);
+			generated_board.rotate_players();
+		}
+		generated_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		start = std::chrono::steady_clock::now();
+		replayed_board.replay(game);
+		replayed_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		generated_hash = generated_board.get_hash();
+		replayed_hash = replayed_board.get_hash();
+
+		for (std::size_t ply{ 0 }; ply < game.size(); ++ply) {
+
+			generated_board.rotate_players();
+			generated_board.execute_undo_command();
+			replayed_board.undo_replay_move();
+		}
+	}
+
+	all_match = all_match && (generated_hash == replayed_hash);
+
+	const double plies{ static_cast<double>(replays) * game.size() };
+	std::cout << "Replaying a " << game.size() << " ply game " << replays << " times: generating movelists " << static_cast<std::uint64_t>(plies / generated_time)
+		<< " plies/s, replaying " << static_cast<std::uint64_t>(plies / replayed_time) << " plies/s." << ((generated_hash == replayed_hash) ? "\n" : " MISMATCH!\n");
+
+	//branch a side line off every tenth ply of the game, and play each one twice so the second follows the nodes of the first. then jump between random
+	//nodes, and compare the board with the node's line replayed from the start.
+	Chess::VariationTree tree{ FEN(FEN::standard_position) };
+	std::mt19937 random;
+	std::size_t played_plies{ 0 };
+
+	for (const Chess::Move& move : game)
+		tree.play(move);
+
+	played_plies += game.size();
+
+	for (Chess::VariationTree::NodeIndex node{ tree.get_current() }; node != Chess::VariationTree::root; node = tree.get_parent(node)) {
+
+		if (tree.get_depth(node) % 10 != 0)
+			continue;
+
+		std::vector<Chess::Move> side_line;
+		tree.jump(node);
+
+		for (int ply{ 0 }; ply < 20; ++ply) {
+
+			Chess::Move moves[Chess::Position::max_moves];
+			const int count{ tree.get_board().copy_position().generate_moves(moves) };
+
+			if (count == 0)
+				break;
+
+			side_line.push_back(moves[std::uniform_int_distribution<int>(0, count - 1)(random)]);
+			tree.play(side_line.back());
+		}
+
+		tree.jump(node);
+		for (const Chess::Move& move : side_line)
+			tree.play(move);
+
+		played_plies += 2 * side_line.size();
+	}
+
+	Chess::Board line_board{ FEN(FEN::standard_position) };
+	const int jumps{ 10000 };
+	bool jumps_match{ true };
+	double jump_time{ 0.0 };
+
+	for (int i{ 0 }; i < jumps; ++i) {
+
+		const auto node{ static_cast<Chess::VariationTree::NodeIndex>(std::uniform_int_distribution<std::size_t>(0, tree.size() - 1)(random)) };
+
+		const auto start{ std::chrono::steady_clock::now() };
+		tree.jump(node);
+		jump_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		const std::size_t plies{ line_board.replay(tree.get_line(node), true) };
+		jumps_match = jumps_match && (line_board.get_hash() == tree.get_board().get_hash());
+
+		for (std::size_t ply{ 0 }; ply < plies; ++ply)
+			line_board.undo_replay_move();
+	}
+
+	all_match = all_match && jumps_match;
+
+	std::cout << "Variation tree: " << played_plies << " plies played into " << tree.size() << " nodes, " << static_cast<std::uint64_t>(jumps / jump_time)
+		<< " jumps/s between random nodes." << (jumps_match ? "\n" : " MISMATCH!\n");
+
+	//search the same positions to see how many moves the staged move generation never had to generate, against generating them all at every node.
+	Chess::SearchStatistics statistics;
+
+	for (const char* position : positions) {
+
+		Chess::Board board{ FEN(position) };
+
+		Chess::SearchLimits limits;
+		limits.m_depth = depth + 1;
+		limits.m_measure_generation = true;
+
+		Chess::Search search(board);
+		const Chess::SearchStatistics position_statistics{ search.search(limits).m_statistics };
+
+		statistics.m_interior_nodes += position_statistics.m_interior_nodes;
+		statistics.m_generated_moves += position_statistics.m_generated_moves;
+		statistics.m_searched_moves += position_statistics.m_searched_moves;
+		statistics.m_legal_moves += position_statistics.m_legal_moves;
+	}
+
+	//the hash move's and killers' pieces are generated twice, so a search that needs every move generates more than the legal moves.
+	const long long saved{ static_cast<long long>(statistics.m_legal_moves) - static_cast<long long>(statistics.m_generated_moves) };
+
+	std::cout << "Searching to depth " << (depth + 1) << ": " << statistics.m_interior_nodes << " interior nodes had " << statistics.m_legal_moves << " legal moves, "
+		<< statistics.m_generated_moves << " were generated and " << statistics.m_searched_moves << " searched. Staged generation saved generating "
+		<< saved << " moves (" << (100.0 * saved / std::max<std::uint64_t>(statistics.m_legal_moves, 1)) << "%).\n";
+
+	return all_match ? 0 : 1;
+}
+
+//usage: ChessProject legal [games] [seed]
+//play random games from the standard perft positions, and at every ply ask is_legal about every from and to (and every promotion piece) and compare its
+//answers with the movelist.
+int run_legality_check(int argc, char* argv[])
+{
+	const int games{ (argc > 2) ? std::stoi(argv[2]) : 100 };
+	std::mt19937 random((argc > 3) ? static_cast<std::mt19937::result_type>(std::stoul(argv[3])) : std::mt19937::default_seed);
+
+	const char* positions[] = {
+		FEN::standard_position,
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+		"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+		"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10"
+	};
+
+	//a game is cut short after this many plies.
+	const int max_plies{ 200 };
+
+	std::uint64_t checks{ 0 };
+	std::uint64_t mismatches{ 0 };
+
+	for (int game{ 0 }; game < games; ++game) {
+
+		Chess::Board board{ FEN(positions[game % (sizeof(positions) / sizeof(positions[0]))]) };
+
+		//the movelists of the moves made are kept, as the board doesn't own the commands it makes.
+		std::vector<std::vector<Chess::MoveList>> played;
+
+		for (int ply{ 0 }; ply < max_plies; ++ply) {
+
+			board.generate_legal_moves();
+			played.push_back(board.take_move_list());
+
+			std::vector<Chess::MoveList>& moves{ played.back() };
+			const char* promotion_pieces{ (board.get_player().get_faction() == Chess::Faction::White) ? "QRBN" : "qrbn" };
+
+			std::vector<Chess::ChessCommandBase*> commands;
+
+			for (int from_square{ 0 }; from_square < Chess::Board::Squares::count; ++from_square) {
+
+				const int from{ Chess::Board::Squares::positions[from_square] };
+				const auto movelist{ std::find_if(moves.begin(), moves.end(), [from](const Chess::MoveList& list) { return list.get_origin() == from; }) };
+
+				for (int to_square{ 0 }; to_square < Chess::Board::Squares::count; ++to_square) {
+
+					const int to{ Chess::Board::Squares::positions[to_square] };
+					Chess::ChessCommandBase* command{ nullptr };
+
+					if (movelist != moves.end()) {
+
+						const auto found{ movelist->find_in_list(to) };
+
+						if (found != movelist->end())
+							command = found->get();
+					}
+
+					//a promotion is only legal with a promotion piece, any other move only without one.
+					const bool is_promotion{ command != nullptr && command->is_promotion() };
+					const bool expected[] = { command != nullptr && !is_promotion, is_promotion, is_promotion, is_promotion, is_promotion };
+					const char promotions[] = { 0, promotion_pieces[0], promotion_pieces[1], promotion_pieces[2], promotion_pieces[3] };
+
+					for (int i{ 0 }; i < 5; ++i) {
+
+						++checks;
+
+						if (board.is_legal(from, to, promotions[i]) == expected[i])
+							continue;
+
+						if (++mismatches <= 10)
+							std::cout << "Mismatch in game " << game << " at ply " << ply << ": " << Chess::Board::Squares::get_file_notation(from_square) << Chess::Board::Squares::get_rank_notation(from_square)
+							<< Chess::Board::Squares::get_file_notation(to_square) << Chess::Board::Squares::get_rank_notation(to_square) << (promotions[i] ? std::string(1, promotions[i]) : "") << " should be "
+							<< (expected[i] ? "legal" : "illegal") << ".\n";
+					}
+
+					if (command != nullptr)
+						commands.push_back(command);
+				}
+			}
+
+			//the game is over when there is nothing left to play.
+			if (commands.empty())
+				break;
+
+			Chess::ChessCommandBase& command{ *commands[std::uniform_int_distribution<std::size_t>(0, commands.size() - 1)(random)] };
+
+			board.make_move(command);
+
+			if (board.is_promotion())
+				board.promote(promotion_pieces[std::uniform_int_distribution<int>(0, 3)(random)]);
+
+			board.rotate_players();
+		}
+	}
+
+	std::cout << checks << " moves checked over " << games << " games, " << mismatches << " mismatches.\n";
+	return (mismatches == 0) ? 0 : 1;
+}
+
+//usage: ChessProject fen [positions file]
+//write each position as FEN, make a second board from what was written, and compare the two. the file has a FEN per line, without one a set of positions
+//covering castling, enpassant for either side and the clocks is used.
+int run_fen_round_trip(int argc, char* argv[])
+{
+	std::vector<std::string> positions{
+		FEN::standard_position,
+		"rnbqkbnr/ppp1pppp/8/3pP3/8/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 3",
+		"rnbqkbnr/pppp1ppp/8/8/3Pp3/8/PPP1PPPP/RNBQKBNR b KQkq d3 0 3",
+		"rnbqkbnr/pppp1ppp/8/8/4p3/8/PPPPPPPP/RNBQKBNR w KQkq - 0 2",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+		"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 b - - 37 88",
+		"8/8/3k4/8/8/3K4/8/8 w - - 99 1"
+	};
+
+	if (argc > 2) {
+
+		std::ifstream file(argv[2]);
+
+		if (!file) {
+
+			std::cout << "Could not open positions: " << argv[2] << "\n";
+			return 1;
+		}
+
+		positions.clear();
+
+		for (std::string line; std::getline(file, line);)
+			if (!line.empty())
+				positions.push_back(line);
+	}
+
+	std::size_t mismatches{ 0 };
+
+	for (const std::string& position : positions) {
+
+		try {
+
+			const Chess::Board board{ FEN(position) };
+			const std::string written{ board.get_fen() };
+			const Chess::Board written_board{ FEN(written) };
+
+			bool tiles_match{ true };
+
+			for (int square{ 0 }; square < Chess::Board::Squares::count; ++square) {
+
+				const int tile_position{ Chess::Board::Squares::positions[square] };
+				tiles_match = tiles_match && (board[tile_position].get_notation() == written_board[tile_position].get_notation());
+			}
+
+			const bool match{ tiles_match && (board.get_player_faction() == written_board.get_player_faction())
+				&& (board.get_castle_permissions() == written_board.get_castle_permissions())
+				&& (board.get_enpassant_position() == written_board.get_enpassant_position())
+				&& (board.get_half_move_clock() == written_board.get_half_move_clock()) && (board.get_full_move_clock() == written_board.get_full_move_clock()) };
+
+			if (!match) {
+
+				++mismatches;
+				std::cout << "MISMATCH " << position << " was written as " << written << "\n";
+			}
+		}
+		catch (std::exception& e) {
+
+			++mismatches;
+			std::cout << "Error in " << position << ": " << e.what() << "\n";
+		}
+	}
+
+	std::cout << positions.size() << " positions written and read back, " << mismatches << " mismatches.\n";
+	return (mismatches == 0) ? 0 : 1;
+}
+
+//usage: ChessProject pack <positions.epd> <positions.bin>
+//each line of the input may be a FEN or an EPD record.
+int pack_positions(int argc, char* argv[])
+{
+	if (argc < 4) {
+
+		std::cout << "Usage: pack <positions.epd> <positions.bin>\n";
+		return 1;
+	}
+
+	std::ifstream input(argv[2]);
+	std::ofstream output(argv[3], std::ios::binary);
+
+	if (!input || !output) {
+
+		std::cout << "Could not open " << (!input ? argv[2] : argv[3]) << "\n";
+		return 1;
+	}
+
+	std::size_t packed{ 0 };
+	std::size_t line_number{ 0 };
+	std::string line{};
+
+	while (std::getline(input, line)) {
+
+		++line_number;
+
+		if (line.find_first_not_of(" \t\r") == std::string::npos)
+			continue;
+
+		try {
+
+			const Chess::Board board(FEN(EPD(line).get_fen()));
+			const PackedPosition packed_position{ board.encode() };
+
+			output.write(reinterpret_cast<const char*>(packed_position.m_bytes.data()), PackedPosition::size);
+			++packed;
+		}
+		catch (std::exception& e) {
+
+			std::cout << "Skipping line " << line_number << ": " << e.what() << "\n";
+		}
+	}
+
+	std::cout << "Packed " << packed << " positions into " << (packed * PackedPosition::size) << " bytes.\n";
+	return 0;
+}
+
+//usage: ChessProject unpack <positions.bin>
+//prints the FEN of every record, the timing goes to stderr so the output can be compared against the original.
+int unpack_positions(int argc, char* argv[])
+{
+	if (argc < 3) {
+
+		std::cout << "Usage: unpack <positions.bin>\n";
+		return 1;
+	}
+
+	try {
+
+		const PackedPositionFile positions(argv[2]);
+
+		char fen[Chess::Board::max_fen_length];
+		std::string output{};
+		output.reserve(positions.size() * 64);
+
+		const auto start{ std::chrono::steady_clock::now() };
+
+		for (const auto packed_position : positions) {
+
+			const Chess::Board board(packed_position);
+			output.append(fen, board.write_fen(fen, sizeof(fen)));
+			output.push_back('\n');
+		}
+
+		const double seconds{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+		std::cout << output;
+		std::cerr << "Decoded " << positions.size() << " positions in " << seconds << "s (" << static_cast<std::size_t>(positions.size() / ((seconds > 0.0) ? seconds : 1.0)) << " positions/s).\n";
+		return 0;
+	}
+	catch (std::exception& e) {
+
+		std::cout << "Error: " << e.what() << "\n";
+		return 1;
+	}
+}
+
+//usage: ChessProject watch [move time ms] [fen]
+//the computer plays itself, the board is redrawn in place after every move by rewriting only the tiles that changed.
+int watch_game(int argc, char* argv[])
+{
+	const std::chrono::milliseconds move_time{ (argc > 2) ? std::stoi(argv[2]) : 500 };
+	const std::string fen{ (argc > 3) ? argv[3] : FEN::standard_position };
+
+	try {
+
+		Chess::Board board{ FEN(fen) };
+		Chess::TranspositionTable table(16);
+		Chess::BoardRenderer renderer;
+
+		std::string status{ "Start position." };
+		renderer.render(board.get_display_cells(), status, std::cout);
+
+		for (;;) {
+
+			const Chess::BoardState state{ board.state() };
+
+			if (state != Chess::BoardState::Legal) {
+
+				const bool white_to_play{ board.get_player_faction() == Chess::Faction::White };
+
+				status += (state == Chess::BoardState::Checkmate) ? (white_to_play ? " Black mates, 0-1." : " White mates, 1-0.")
+					: (state == Chess::BoardState::Repetition) ? " Draw by repetition." : " Drawn.";
+				renderer.redraw(board.get_display_cells(), status, std::cout);
+				return 0;
+			}
+
+			Chess::SearchLimits limits;
+			limits.m_move_time = move_time;
+
+			Chess::Search search(board, &table);
+			const Chess::SearchResult result{ search.search(limits) };
+
+			//the search used up the movelist.
+			board.generate_legal_moves();
+
+			const int move_number{ board.get_full_move_clock() };
+			const bool white_moved{ board.get_player_faction() == Chess::Faction::White };
+			const std::string san{ board.convert_move_to_san(result.m_best_move) };
+
+			board.find_and_execute_move(result.m_best_move);
+			board.rotate_players();
+
+			status = std::to_string(move_number) + (white_moved ? ". " : "... ") + san + " (depth " + std::to_string(result.m_depth) + ", score " + std::to_string(result.m_score) + ")";
+			renderer.redraw(board.get_display_cells(), status, std::cout);
+		}
+	}
+	catch (std::exception& e) {
+
+		std::cout << "Error: " << e.what() << "\n";
+		return 1;
+	}
+}
+
+//usage: ChessProject script <commands file> [fen]
+//plays a game from a file of commands, one per line as they would be typed, e.g 'e2;e4', 'undo' or a promotion's initial.
+int run_script(int argc, char* argv[])
+{
+	if (argc < 3) {
+
+		std::cout << "Usage: script <commands file> [fen]\n";
+		return 1;
+	}
+
+	std::ifstream script(argv[2]);
+
+	if (!script) {
+
+		std::cout << "Could not open script: " << argv[2] << "\n";
+		return 1;
+	}
+
+	const std::string fen{ (argc > 3) ? argv[3] : FEN::standard_position };
+
+	try {
+
+		const auto start{ std::chrono::steady_clock::now() };
+		Chess::Game game(FEN(fen), script);
+		const auto elapsed{ std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start) };
+
+		std::cout << "Read " << game.get_commands_read() << " commands in " << elapsed.count() << "ms.\n";
+		return 0;
+	}
+	catch (std::exception& e) {
+
+		std::cout << "Error: " << e.what() << "\n";
+		return 1;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	//batch tools are run from the command line rather than the menu.
+	if (argc > 1) {
+
+		const std::string mode{ argv[1] };
+
+		if (mode == "epd")
+			return run_epd_suite(argc, argv);
+		if (mode == "pgn")
+			return replay_pgn_archive(argc, argv);
+		if (mode == "uci") {
+
+			Chess::UCI uci(std::cin, std::cout);
+			uci.run();
+			return 0;
+		}
+		if (mode == "match")
+			return run_match(argc, argv);
+		if (mode == "bench")
+			return run_benchmark(argc, argv);
+		if (mode == "legal")
+			return run_legality_check(argc, argv);
+		if (mode == "fen")
+			return run_fen_round_trip(argc, argv);
+		if (mode == "pack")
+			return pack_positions(argc, argv);
+		if (mode == "unpack")
+			return unpack_positions(argc, argv);
+		if (mode == "watch")
+			return watch_game(argc, argv);
+		if (mode == "script")
+			return run_script(argc, argv);
+
+		std::cout << "Unknown mode '" << mode << "'. Available modes: uci, match, epd, pgn, bench, legal, fen, pack, unpack, watch, script.\n";
+		return 1;
+	}
+
 	std::cout << "--------------------------------\n"
 		<< "   _____ _                   \n"
 		<< "  / ____| |                  \n"
@@ -90,10 +820,13 @@ int main()
 			<< "[11]. Debug: Promotion Check Evasion: Moving a pawn to promotion is a valid check evasion.\n"
 			<< "[12]. Debug: Fifty Move draw.\n"
 			<< "[13]. Debug: Stalemate.\n"
-			<< "[14]. Exit.\n"
+			<< "--------------------------------------------------------------------\n"
+			<< "[14]. Standard Chess against the computer, you play white.\n"
+			<< "[15]. Standard Chess against the computer, you play black.\n"
+			<< "[16]. Exit.\n"
 			<< "\nPlease select an option:\n";
 
-		int selection = get_int_in_range(0, 14);
+		int selection = get_int_in_range(0, 16);
 
 		switch (selection)
 		{
@@ -184,7 +917,7 @@ int main()
 		//fifty move draw
 		case 12:
 		{
-			FEN fen("8/8/3k4/8/8/3K4/8/8 w - - 49 1");
+			FEN fen("8/8/3k4/8/8/3K4/8/8 w - - 99 1");
 			Chess::Game game(fen);
 			break;
 		}
@@ -195,8 +928,21 @@ int main()
 			Chess::Game game(fen);
 			break;
 		}
-		//exit
+		//against the computer
 		case 14:
+		{
+			FEN fen(FEN::standard_position);
+			Chess::Game game(fen, Chess::Faction::Black);
+			break;
+		}
+		case 15:
+		{
+			FEN fen(FEN::standard_position);
+			Chess::Game game(fen, Chess::Faction::White);
+			break;
+		}
+		//exit
+		case 16:
 		{
 			std::cout << "Thanks for playing!\n";
 			run = false;
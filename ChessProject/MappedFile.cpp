@@ -0,0 +1,113 @@
+#include "MappedFile.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& path)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+		throw std::runtime_error("Could not open file for mapping: " + path);
+
+	m_file_handle = file;
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size)) {
+
+		CloseHandle(file);
+		throw std::runtime_error("Could not read the size of file: " + path);
+	}
+
+	m_size = static_cast<std::size_t>(file_size.QuadPart);
+
+	//empty files can not be mapped, but are perfectly valid (and empty) views.
+	if (m_size == 0)
+		return;
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (mapping == nullptr) {
+
+		CloseHandle(file);
+		throw std::runtime_error("Could not map file: " + path);
+	}
+
+	m_mapping_handle = mapping;
+	m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+	if (m_data == nullptr) {
+
+		CloseHandle(mapping);
+		CloseHandle(file);
+		throw std::runtime_error("Could not map file: " + path);
+	}
+#else
+	m_file_descriptor = open(path.c_str(), O_RDONLY);
+
+	if (m_file_descriptor < 0)
+		throw std::runtime_error("Could not open file for mapping: " + path);
+
+	struct stat file_status;
+	if (fstat(m_file_descriptor, &file_status) != 0) {
+
+		close(m_file_descriptor);
+		throw std::runtime_error("Could not read the size of file: " + path);
+	}
+
+	m_size = static_cast<std::size_t>(file_status.st_size);
+
+	//empty files can not be mapped, but are perfectly valid (and empty) views.
+	if (m_size == 0)
+		return;
+
+	void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file_descriptor, 0);
+
+	if (data == MAP_FAILED) {
+
+		close(m_file_descriptor);
+		throw std::runtime_error("Could not map file: " + path);
+	}
+
+	//the file is read front to back, let the kernel read ahead aggressively.
+	madvise(data, m_size, MADV_SEQUENTIAL);
+	m_data = static_cast<const char*>(data);
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& mapped_file) noexcept : m_data(mapped_file.m_data), m_size(mapped_file.m_size), m_file_handle(mapped_file.m_file_handle),
+	m_mapping_handle(mapped_file.m_mapping_handle), m_file_descriptor(mapped_file.m_file_descriptor)
+{
+	mapped_file.m_data = nullptr;
+	mapped_file.m_size = 0;
+	mapped_file.m_file_handle = nullptr;
+	mapped_file.m_mapping_handle = nullptr;
+	mapped_file.m_file_descriptor = -1;
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+	if (m_data != nullptr)
+		UnmapViewOfFile(m_data);
+	if (m_mapping_handle != nullptr)
+		CloseHandle(m_mapping_handle);
+	if (m_file_handle != nullptr)
+		CloseHandle(m_file_handle);
+#else
+	if (m_data != nullptr)
+		munmap(const_cast<char*>(m_data), m_size);
+	if (m_file_descriptor >= 0)
+		close(m_file_descriptor);
+#endif
+}
@@ -0,0 +1,44 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class maps a whole file read-only into memory and exposes it as a string_view. Readers can then tokenise large game archives in place, without copying them
+into strings, and the operating system pages the file in as it is read. Mapping uses CreateFileMapping on Windows and mmap elsewhere.
+*/
+
+#ifndef __MAPPEDFILE_HEADER
+#define __MAPPEDFILE_HEADER
+
+#include <string>
+#include <string_view>
+
+class MappedFile
+{
+public:
+	MappedFile(const std::string& path);
+	~MappedFile();
+
+	//owns the mapping, so only allow it to be moved.
+	MappedFile(MappedFile&& mapped_file) noexcept;
+	MappedFile& operator=(MappedFile&& mapped_file) = delete;
+	MappedFile(const MappedFile& mapped_file) = delete;
+	MappedFile& operator=(const MappedFile& mapped_file) = delete;
+
+	//the contents of the file, valid for the lifetime of this object.
+	const std::string_view view() const { return std::string_view(m_data, m_size); }
+	const std::size_t size() const { return m_size; }
+
+private:
+
+	const char* m_data{ nullptr };
+	std::size_t m_size{ 0 };
+
+	//platform handles, kept opaque so the platform headers stay out of this header.
+	void* m_file_handle{ nullptr };
+	void* m_mapping_handle{ nullptr };
+	int m_file_descriptor{ -1 };
+};
+
+#endif
@@ -0,0 +1,309 @@
+#include "Match.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "FEN.h"
+
+const std::string Chess::TimeControl::get_notation() const
+{
+	std::ostringstream notation;
+	notation << (m_base.count() / 1000.0) << '+' << (m_increment.count() / 1000.0);
+
+	return notation.str();
+}
+
+Chess::Match::Match(const MatchSettings& settings, std::vector<std::string> openings) : m_settings(settings), m_openings(std::move(openings))
+{
+	if (m_openings.empty())
+		m_openings.push_back(FEN::standard_position);
+
+	//the PGN Date tag, worked out once as localtime isn't thread-safe.
+	const std::time_t now{ std::time(nullptr) };
+	std::ostringstream date;
+	date << std::put_time(std::localtime(&now), "%Y.%m.%d");
+	m_date = date.str();
+}
+
+const SPRTState Chess::Match::run(std::ostream& pgn, std::ostream& report)
+{
+	SPRT sprt(m_settings.m_elo0, m_settings.m_elo1, m_settings.m_alpha, m_settings.m_beta);
+	SPRTState state{ SPRTState::Continue };
+
+	std::atomic<int> next_game{ 0 };
+	std::atomic<bool> concluded{ false };
+	std::mutex results_mutex;
+
+	const auto start{ std::chrono::steady_clock::now() };
+
+	report << "Match: " << m_settings.m_first.m_name << " vs " << m_settings.m_second.m_name << ", " << m_settings.m_games << " games at "
+		<< m_settings.m_time_control.get_notation() << " on " << m_settings.m_threads << " threads, SPRT elo0 " << m_settings.m_elo0 << " elo1 " << m_settings.m_elo1
+		<< " bounds (" << std::fixed << std::setprecision(2) << sprt.get_lower_bound() << ", " << sprt.get_upper_bound() << ").\n";
+
+	std::vector<std::thread> workers;
+
+	for (unsigned int i{ 0 }; i < std::max(1u, m_settings.m_threads); ++i) {
+
+		workers.emplace_back([this, &next_game, &concluded, &results_mutex, &sprt, &state, &pgn, &report]() {
+
+			//each worker reuses its own tables, they are cleared between games so games don't influence each other.
+			TranspositionTable first_table(m_settings.m_first.m_hash_megabytes);
+			TranspositionTable second_table(m_settings.m_second.m_hash_megabytes);
+
+			int index;
+			while (!concluded && ((index = next_game++) < m_settings.m_games)) {
+
+				first_table.clear();
+				second_table.clear();
+
+				const GameRecord record{ play_game(index, first_table, second_table) };
+
+				std::lock_guard<std::mutex> lock(results_mutex);
+
+				//games still being played when the test concluded are not counted, so the stopping rule holds.
+				if (concluded)
+					return;
+
+				write_pgn(record, pgn);
+
+				const bool first_won{ (record.m_result == "1-0") == record.m_first_is_white };
+				const bool draw{ record.m_result == "1/2-1/2" };
+
+				sprt.add_result((!draw && first_won) ? 1 : 0, draw ? 1 : 0, (!draw && !first_won) ? 1 : 0);
+				state = sprt.get_state();
+
+				report << "Game " << (record.m_index + 1) << ": " << record.m_result << " {" << record.m_reason << "}. Score "
+					<< sprt.get_wins() << " - " << sprt.get_losses() << " - " << sprt.get_draws()
+					<< ", Elo " << sprt.get_elo() << " +/- " << sprt.get_elo_error() << ", LLR " << sprt.get_llr() << "\n";
+
+				if (state != SPRTState::Continue)
+					concluded = true;
+			}
+		});
+	}
+
+	for (auto& worker : workers)
+		worker.join();
+
+	const double seconds{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+	report << "Finished " << sprt.get_games() << " games in " << seconds << "s. " << m_settings.m_first.m_name << " scored "
+		<< sprt.get_wins() << " - " << sprt.get_losses() << " - " << sprt.get_draws() << ", Elo " << sprt.get_elo() << " +/- " << sprt.get_elo_error() << ".\n"
+		<< "SPRT: LLR " << sprt.get_llr() << ", "
+		<< ((state == SPRTState::AcceptH1) ? "H1 accepted, the change is an improvement.\n" : (state == SPRTState::AcceptH0) ? "H0 accepted, the change is not an improvement.\n" : "inconclusive.\n");
+
+	return state;
+}
+
+const Chess::Match::GameRecord Chess::Match::play_game(const int index, TranspositionTable& first_table, TranspositionTable& second_table) const
+{
+	GameRecord record;
+	record.m_index = index;
+	record.m_opening = m_openings[(index / 2) % m_openings.size()];
+	record.m_first_is_white = (index % 2) == 0;
+
+	Board board{ FEN(record.m_opening) };
+
+	//indexed by whether it is white's clock.
+	std::chrono::milliseconds clocks[2]{ m_settings.m_time_control.m_base, m_settings.m_time_control.m_base };
+
+	int draw_plies{ 0 };
+	int resign_plies{ 0 };
+	int last_white_score{ 0 };
+
+	for (int ply{ 0 }; ; ++ply) {
+
+		board.determine_current_check_state();
+		const bool has_moves{ board.has_legal_move() };
+
+		//the previous move's check suffix is only known now that the reply has been generated.
+		if (!record.m_moves.empty() && board.get_current_check_state())
+			record.m_moves.back() += has_moves ? '+' : '#';
+
+		const bool white_to_play{ board.get_player_faction() == Faction::White };
+
+		if (!has_moves) {
+
+			record.m_termination = "normal";
+
+			if (board.get_current_check_state()) {
+
+				record.m_result = white_to_play ? "0-1" : "1-0";
+				record.m_reason = std::string(white_to_play ? "Black" : "White") + " mates";
+			}
+			else {
+
+				record.m_result = "1/2-1/2";
+				record.m_reason = "Stalemate";
+			}
+			break;
+		}
+
+		if (board.get_half_move_clock() >= 100 || board.is_repetition(2) || is_insufficient_material(board)) {
+
+			record.m_result = "1/2-1/2";
+			record.m_termination = "normal";
+			record.m_reason = (board.get_half_move_clock() >= 100) ? "Fifty move rule" : board.is_repetition(2) ? "Threefold repetition" : "Insufficient material";
+			break;
+		}
+
+		if (ply >= m_settings.m_max_plies) {
+
+			record.m_result = "1/2-1/2";
+			record.m_termination = "adjudication";
+			record.m_reason = "Maximum game length";
+			break;
+		}
+
+		const bool first_to_play{ white_to_play == record.m_first_is_white };
+		const MatchEngine& engine{ first_to_play ? m_settings.m_first : m_settings.m_second };
+		std::chrono::milliseconds& clock{ clocks[white_to_play ? 1 : 0] };
+
+		SearchLimits limits;
+		limits.m_move_time = SearchLimits::allocate_time(clock, m_settings.m_time_control.m_increment);
+		if (engine.m_depth > 0)
+			limits.m_depth = engine.m_depth;
+
+		const auto move_start{ std::chrono::steady_clock::now() };
+
+		Search search(board, first_to_play ? &first_table : &second_table);
+		const SearchResult result{ search.search(limits) };
+
+		clock -= std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - move_start);
+
+		if (clock.count() <= 0) {
+
+			record.m_result = white_to_play ? "0-1" : "1-0";
+			record.m_termination = "time forfeit";
+			record.m_reason = std::string(white_to_play ? "White" : "Black") + " loses on time";
+			break;
+		}
+
+		clock += m_settings.m_time_control.m_increment;
+
+		//the search used up the movelist.
+		board.generate_legal_moves();
+		record.m_moves.push_back(board.convert_move_to_san(result.m_best_move));
+		board.find_and_execute_move(result.m_best_move);
+		board.rotate_players();
+
+		//adjudicate on the scores from white's point of view, both engines must agree so count consecutive plies.
+		const int white_score{ white_to_play ? result.m_score : -result.m_score };
+
+		draw_plies = ((board.get_full_move_clock() >= m_settings.m_draw_move_number) && (std::abs(white_score) <= m_settings.m_draw_score)) ? draw_plies + 1 : 0;
+		resign_plies = ((std::abs(white_score) >= m_settings.m_resign_score) && ((white_score > 0) == (last_white_score > 0))) ? resign_plies + 1 : 0;
+		last_white_score = white_score;
+
+		if (draw_plies >= m_settings.m_draw_plies) {
+
+			record.m_result = "1/2-1/2";
+			record.m_termination = "adjudication";
+			record.m_reason = "Draw by adjudication";
+			break;
+		}
+
+		if (resign_plies >= m_settings.m_resign_plies) {
+
+			record.m_result = (white_score > 0) ? "1-0" : "0-1";
+			record.m_termination = "adjudication";
+			record.m_reason = std::string((white_score > 0) ? "Black" : "White") + " resigns";
+			break;
+		}
+	}
+
+	return record;
+}
+
+const bool Chess::Match::is_insufficient_material(const Board& board) const
+{
+	int minor_pieces{ 0 };
+
+	for (int position{ 0 }; position < static_cast<int>(board.size()); ++position) {
+
+		const Tile& tile{ board[position] };
+
+		if (tile == TileType::Pawn || tile == TileType::Rook || tile == TileType::Queen)
+			return false;
+
+		if (tile == TileType::Knight || tile == TileType::Bishop)
+			++minor_pieces;
+	}
+
+	//a lone minor piece can't force mate.
+	return minor_pieces <= 1;
+}
+
+void Chess::Match::write_pgn(const GameRecord& record, std::ostream& pgn) const
+{
+	const std::string& white{ record.m_first_is_white ? m_settings.m_first.m_name : m_settings.m_second.m_name };
+	const std::string& black{ record.m_first_is_white ? m_settings.m_second.m_name : m_settings.m_first.m_name };
+
+	pgn << "[Event \"ChessProject match\"]\n"
+		<< "[Site \"?\"]\n"
+		<< "[Date \"" << m_date << "\"]\n"
+		<< "[Round \"" << (record.m_index + 1) << "\"]\n"
+		<< "[White \"" << white << "\"]\n"
+		<< "[Black \"" << black << "\"]\n"
+		<< "[Result \"" << record.m_result << "\"]\n";
+
+	if (record.m_opening != FEN::standard_position) {
+
+		pgn << "[SetUp \"1\"]\n"
+			<< "[FEN \"" << record.m_opening << "\"]\n";
+	}
+
+	pgn << "[PlyCount \"" << record.m_moves.size() << "\"]\n"
+		<< "[TimeControl \"" << m_settings.m_time_control.get_notation() << "\"]\n"
+		<< "[Termination \"" << record.m_termination << "\"]\n\n";
+
+	//the move numbers follow on from the opening's.
+	const FEN opening(record.m_opening);
+	int move_number{ std::stoi(opening.get_full_move_clock()) };
+	bool white_to_play{ opening.get_player_to_play() == "w" };
+
+	std::string movetext;
+	std::size_t line_length{ 0 };
+
+	auto append = [&movetext, &line_length](const std::string& token) {
+
+		//PGN lines are kept under 80 charachters.
+		if (line_length != 0 && (line_length + 1 + token.size()) > 79) {
+
+			movetext += '\n';
+			line_length = 0;
+		}
+		else if (line_length != 0) {
+
+			movetext += ' ';
+			++line_length;
+		}
+
+		movetext += token;
+		line_length += token.size();
+	};
+
+	for (std::size_t i{ 0 }; i < record.m_moves.size(); ++i) {
+
+		if (white_to_play)
+			append(std::to_string(move_number) + ".");
+		else if (i == 0)
+			append(std::to_string(move_number) + "...");
+
+		append(record.m_moves[i]);
+
+		if (!white_to_play)
+			++move_number;
+
+		white_to_play = !white_to_play;
+	}
+
+	append("{" + record.m_reason + "}");
+	append(record.m_result);
+
+	pgn << movetext << "\n\n";
+}
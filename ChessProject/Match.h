@@ -0,0 +1,111 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to play a headless engine-vs-engine match, in-process, to measure whether a change to the engine makes it stronger. Games are played
+concurrently on a pool of worker threads. Each opening is played twice with the colours reversed. Both sides play on their own clock, and lost or drawn
+positions can be adjudicated early from the engines' scores. Every game is written as PGN, and a sequential probability ratio test on the results stops the match
+as soon as it is significant.
+*/
+
+#ifndef __MATCH_HEADER
+#define __MATCH_HEADER
+
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Board.h"
+#include "Search.h"
+#include "SPRT.h"
+#include "TranspositionTable.h"
+
+namespace Chess {
+
+	struct MatchEngine
+	{
+		std::string m_name;
+		//a fixed search depth, or 0 to let the clock decide.
+		int m_depth{ 0 };
+		std::size_t m_hash_megabytes{ 8 };
+	};
+
+	struct TimeControl
+	{
+		std::chrono::milliseconds m_base{ 10000 };
+		std::chrono::milliseconds m_increment{ 100 };
+
+		//in the PGN TimeControl format, seconds plus increment, e.g '10+0.1'.
+		const std::string get_notation() const;
+	};
+
+	struct MatchSettings
+	{
+		//the first engine is the one being tested, the results are from its point of view.
+		MatchEngine m_first{ "Engine 1" };
+		MatchEngine m_second{ "Engine 2" };
+		TimeControl m_time_control;
+
+		int m_games{ 100 };
+		unsigned int m_threads{ 1 };
+
+		//adjudication. a game longer than the maximum is drawn.
+		int m_max_plies{ 400 };
+		//drawn once both engines score the position within the margin for the given number of plies, from the given move on.
+		int m_draw_move_number{ 40 };
+		int m_draw_score{ 10 };
+		int m_draw_plies{ 8 };
+		//lost once both engines agree one side is ahead by the margin for the given number of plies.
+		int m_resign_score{ 1000 };
+		int m_resign_plies{ 6 };
+
+		//SPRT hypotheses and error rates.
+		double m_elo0{ 0.0 };
+		double m_elo1{ 10.0 };
+		double m_alpha{ 0.05 };
+		double m_beta{ 0.05 };
+	};
+
+	class Match
+	{
+	public:
+		Match(const MatchSettings& settings, std::vector<std::string> openings);
+		~Match() {}
+
+		//play the match, writing every game to pgn and the progress to report. returns the state of the SPRT when the match stopped.
+		const SPRTState run(std::ostream& pgn, std::ostream& report);
+
+	private:
+
+		struct GameRecord
+		{
+			int m_index{ 0 };
+			std::string m_opening;
+			bool m_first_is_white{ true };
+
+			std::vector<std::string> m_moves;
+			//"1-0", "0-1" or "1/2-1/2".
+			std::string m_result;
+			//the PGN Termination tag, and a human readable reason for the comment.
+			std::string m_termination;
+			std::string m_reason;
+		};
+
+		const GameRecord play_game(const int index, TranspositionTable& first_table, TranspositionTable& second_table) const;
+
+		//neither side has enough material left to mate.
+		const bool is_insufficient_material(const Board& board) const;
+
+		void write_pgn(const GameRecord& record, std::ostream& pgn) const;
+
+		MatchSettings m_settings;
+		std::vector<std::string> m_openings;
+		std::string m_date;
+	};
+}
+
+#endif
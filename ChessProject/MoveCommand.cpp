@@ -93,21 +93,9 @@ void Chess::CastleCommand::undo(Board& board)
 
 bool Chess::CastleCommand::validate(Board& board)
 {
-	if (board.get_current_check_state())
-		return false;
-
-	for (auto sub_to{ m_from + m_vector }; sub_to != (m_to + m_vector); sub_to += m_vector) {
-
-		//create a temporary sub-move command and execute them all.
-		KingMoveCommand temp_move(m_from, sub_to);
-		
-		if(!temp_move.validate(board)) {
-
-			//if any of the sub moves result in a check then the castle is not valid.
-			return false;
-		}
-	}
-	return true;
+	//the king can't castle out of, through or into check. check is looked for here rather than read off the board, a generator may have moved the board
+	//about since the check state was determined.
+	return !board.is_position_captured(m_from) && board.is_castle_path_safe(m_from, m_to);
 }
 
 void Chess::DoublePushCommand::execute(Board& board)
@@ -166,3 +154,27 @@ bool Chess::PromotionCommand::validate(Board& board)
 
 	return !in_check;
 }
+
+void Chess::PromotionCaptureCommand::execute(Board& board)
+{
+	//take the captured piece off the board before the promoted piece replaces it.
+	board.capture(m_to);
+	PromotionCommand::execute(board);
+}
+
+void Chess::PromotionCaptureCommand::undo(Board& board)
+{
+	PromotionCommand::undo(board);
+	board.revive();
+}
+
+bool Chess::PromotionCaptureCommand::validate(Board& board)
+{
+	board.capture(m_to);
+	board.move(m_from, m_to);
+	bool in_check = board.is_in_check();
+	board.undo_move(m_to, m_from);
+	board.revive();
+
+	return !in_check;
+}
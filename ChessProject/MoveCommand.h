@@ -17,6 +17,15 @@ namespace Chess
 	//inherently linked to the board class, so can't include board directly in this header.
 	class Board;
 
+	//a plain description of a move, for holding onto a move after its command has been discarded, e.g. search results or parsed notation.
+	struct Move
+	{
+		int m_from{ 0 };
+		int m_to{ 0 };
+		//the FEN charachter of the promotion piece, zero if the move is not a promotion.
+		char m_promotion{ 0 };
+	};
+
 	class ChessCommandBase : public CommandInterface<Board>
 	{
 	public:
@@ -26,7 +35,11 @@ namespace Chess
 		//chess commands need to be validated by the board
 		virtual bool validate(Board& board) = 0;
 
+		//promotions are a single command that the board expands once the promotion piece is chosen.
+		virtual const bool is_promotion() const { return false; }
+
 		//need to expose for sorting/find_if.
+		inline const int get_from() const { return m_from; }
 		inline const int get_to() const { return m_to; }
 
 	protected:
@@ -148,12 +161,29 @@ namespace Chess
 		//special case of validate, we just need to check if the presence of the pawn on the back row blocks a check.
 		virtual bool validate(Board& board) override;
 
+		virtual const bool is_promotion() const override { return true; }
+
 	protected:
 
 		//the co-validation method in 'board'.
 
 
 	};
+
+	//a pawn capturing onto the end of the board also promotes.
+	class PromotionCaptureCommand : public PromotionCommand
+	{
+	public:
+
+		PromotionCaptureCommand(const int from, const int to) : PromotionCommand(from, to) {}
+		virtual ~PromotionCaptureCommand() {}
+
+		virtual void execute(Board& board) override;
+		virtual void undo(Board& board) override;
+
+		//captures need to be validated by explicitly making/unmaking the capture.
+		virtual bool validate(Board& board) override;
+	};
 }
 
 #endif
\ No newline at end of file
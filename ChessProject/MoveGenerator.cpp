@@ -0,0 +1,270 @@
+#include "MoveGenerator.h"
+
+#include "AttackTables.h"
+#include "FactionTraits.h"
+
+void Chess::MoveGenerator::generate(std::vector<MoveList>& moves) const
+{
+	(m_board.get_player_faction() == Faction::White) ? generate_all<Faction::White>(moves) : generate_all<Faction::Black>(moves);
+}
+
+Chess::MoveList Chess::MoveGenerator::generate(const int position) const
+{
+	MoveList move_list(position);
+	(m_board.get_player_faction() == Faction::White) ? generate_moves<Faction::White>(position, move_list) : generate_moves<Faction::Black>(position, move_list);
+
+	return move_list;
+}
+
+const int Chess::MoveGenerator::count() const
+{
+	return (m_board.get_player_faction() == Faction::White) ? count_all<Faction::White>() : count_all<Faction::Black>();
+}
+
+template<Chess::Faction Side>
+void Chess::MoveGenerator::generate_all(std::vector<MoveList>& moves) const
+{
+	//validating moves moves the player's pieces about, so index each list rather than holding pointers into it.
+	for (const TileType type : { TileType::Pawn, TileType::Knight, TileType::Bishop, TileType::Rook, TileType::Queen, TileType::King }) {
+
+		const PieceList& piece_list{ m_board.get_pieces().get(Side, type) };
+
+		for (int i{ 0 }; i < piece_list.m_count; ++i) {
+
+			MoveList move_list(piece_list.m_positions[i]);
+			generate_moves<Side>(piece_list.m_positions[i], move_list);
+
+			if (move_list.size() > 0)
+				moves.push_back(std::move(move_list));
+		}
+	}
+}
+
+template<Chess::Faction Side>
+const int Chess::MoveGenerator::count_all() const
+{
+	MoveCounter counter;
+
+	for (const TileType type : { TileType::Pawn, TileType::Knight, TileType::Bishop, TileType::Rook, TileType::Queen, TileType::King }) {
+
+		const PieceList& piece_list{ m_board.get_pieces().get(Side, type) };
+
+		for (int i{ 0 }; i < piece_list.m_count; ++i)
+			generate_moves<Side>(piece_list.m_positions[i], counter);
+	}
+
+	return counter.m_count;
+}
+
+template<Chess::Faction Side, class Output>
+void Chess::MoveGenerator::generate_moves(const int position, Output& output) const
+{
+	switch (m_board[position].getTileType())
+	{
+	case TileType::Pawn:
+		generate_pawn_moves<Side>(position, output);
+		break;
+
+	case TileType::Knight:
+		generate_knight_moves<Side>(position, output);
+		break;
+
+	case TileType::King:
+		generate_king_moves<Side>(position, output);
+		break;
+
+	default:
+		generate_scanning_moves<Side>(position, m_board[position].getTileType(), output);
+		break;
+	}
+}
+
+template<Chess::Faction Side, class Output>
+void Chess::MoveGenerator::generate_pawn_moves(const int position, Output& move_list) const
+{
+	using Traits = FactionTraits<Side>;
+	using Squares = Board::Squares;
+	using TileVector = Board::TileVector;
+
+	const std::uint64_t pin_ray{ get_pin_ray(position) };
+	const std::uint64_t target_mask{ pin_ray & m_check_mask };
+	const int square{ Squares::squares[position] };
+	const int destination_position{ position + Traits::forward };
+
+	//reaching the last row is a promotion, whether pushing or capturing.
+	const bool is_promoting{ Squares::squares[destination_position] / Squares::game_board_x == Traits::promotion_row };
+
+	//a pin across the pawn's file stops it pushing, the double push is on the ray if the single push is. either push may block a check without the other.
+	if (m_board[destination_position] == TileType::Empty && is_on_ray(pin_ray, destination_position)) {
+
+		if (is_promoting) {
+
+			if (m_generation != MoveGeneration::Quiets && is_on_ray(target_mask, destination_position))
+				add_legal<PromotionCommand>(move_list, position, destination_position);
+		}
+		else if (m_generation != MoveGeneration::Captures) {
+
+			if (is_on_ray(target_mask, destination_position))
+				add_legal<MoveCommand>(move_list, position, destination_position);
+
+			//pawns may only double push from their starting row.
+			const int double_push_position{ destination_position + Traits::forward };
+
+			if ((square / Squares::game_board_x) == Traits::pawn_start_row && m_board[double_push_position] == TileType::Empty && is_on_ray(target_mask, double_push_position))
+				add_legal<DoublePushCommand>(move_list, position, double_push_position);
+		}
+	}
+
+	if (m_generation == MoveGeneration::Quiets)
+		return;
+
+	//consider attacks, the table leaves out the border tiles.
+	for (const int capture_position : leaper_attacks.m_pawn[Traits::index][square]) {
+
+		//a pinned pawn may only capture along the pin.
+		if (!is_on_ray(target_mask, capture_position) || m_board[capture_position] != Traits::enemy)
+			continue;
+
+		//capturing onto the last row is also a promotion.
+		if (is_promoting)
+			add_legal<PromotionCaptureCommand>(move_list, position, capture_position);
+		else
+			add_legal<CaptureCommand>(move_list, position, capture_position);
+	}
+
+	//consider enpassants, the pawn to the left or the right is captured by moving behind it. taking two pawns off a row can uncover a check the pin rays
+	//don't cover, so these are always validated instead.
+	for (const int vector : { TileVector::west, TileVector::east }) {
+
+		const int capture_position{ position + vector };
+
+		if (m_board.can_capture_enpassant(capture_position))
+			add<EnpassantCommand>(move_list, position, capture_position + Traits::forward, capture_position);
+	}
+}
+
+template<Chess::Faction Side, class Output>
+void Chess::MoveGenerator::generate_knight_moves(const int position, Output& move_list) const
+{
+	const std::uint64_t target_mask{ get_pin_ray(position) & m_check_mask };
+
+	//the table leaves out the border tiles, so each target is either empty or a piece. no knight move keeps to the line of a pin, so a pinned knight can't move.
+	for (const int destination_position : leaper_attacks.m_knight[Board::Squares::squares[position]]) {
+
+		if (!is_on_ray(target_mask, destination_position))
+			continue;
+
+		if (m_board[destination_position] == TileType::Empty) {
+
+			if (m_generation != MoveGeneration::Captures)
+				add_legal<MoveCommand>(move_list, position, destination_position);
+		}
+		else if (m_board[destination_position] == FactionTraits<Side>::enemy && m_generation != MoveGeneration::Quiets) {
+
+			add_legal<CaptureCommand>(move_list, position, destination_position);
+		}
+	}
+}
+
+template<Chess::Faction Side, class Output>
+void Chess::MoveGenerator::generate_scanning_moves(const int position, const TileType type, Output& move_list) const
+{
+	const std::uint64_t pin_ray{ get_pin_ray(position) };
+	const std::uint64_t check_mask{ m_check_mask };
+
+	//in double check only the king can move.
+	if (check_mask == 0)
+		return;
+
+	for (const int vector : scanning_vectors[static_cast<int>(type)]) {
+
+		//scanning pieces keep moving through the empty tiles.
+		int destination_position{ position + vector };
+
+		//the pin ray is a line through the piece, so either every step in a direction is on it or none is.
+		if (m_board[destination_position] == TileType::Border || !is_on_ray(pin_ray, destination_position))
+			continue;
+
+		while (m_board[destination_position] == TileType::Empty) {
+
+			if (m_generation != MoveGeneration::Captures && is_on_ray(check_mask, destination_position))
+				add_legal<MoveCommand>(move_list, position, destination_position);
+
+			destination_position += vector;
+		}
+
+		//scanning pieces are allowed one capture.
+		if (m_board[destination_position] == FactionTraits<Side>::enemy && m_generation != MoveGeneration::Quiets && is_on_ray(check_mask, destination_position))
+			add_legal<CaptureCommand>(move_list, position, destination_position);
+	}
+}
+
+template<Chess::Faction Side, class Output>
+void Chess::MoveGenerator::generate_king_moves(const int position, Output& move_list) const
+{
+	using TileVector = Board::TileVector;
+
+	//all king moves must be validated! the king is never pinned.
+	for (const int destination_position : leaper_attacks.m_king[Board::Squares::squares[position]]) {
+
+		if (m_board[destination_position] == TileType::Empty) {
+
+			if (m_generation != MoveGeneration::Captures)
+				add<KingMoveCommand>(move_list, position, destination_position);
+		}
+		else if (m_board[destination_position] == FactionTraits<Side>::enemy && m_generation != MoveGeneration::Quiets) {
+
+			add<KingCaptureCommand>(move_list, position, destination_position);
+		}
+	}
+
+	//a king that has moved, or is in check, can't castle.
+	if (m_generation == MoveGeneration::Captures || m_check_mask != ~std::uint64_t(0) || m_board.get_move_count(position) != 0)
+		return;
+
+	const int square{ Board::Squares::squares[position] };
+
+	for (const int vector : { TileVector::west, TileVector::east }) {
+
+		if (!m_board.can_castle_in_vector(vector))
+			continue;
+
+		//the castling rook is in the corner of the king's row.
+		const int rook_square{ ((square / Board::Squares::game_board_x) * Board::Squares::game_board_x) + ((vector == TileVector::east) ? Board::Squares::game_board_x - 1 : 0) };
+		const int rook_position{ Board::Squares::positions[rook_square] };
+
+		//we can't castle /through/ any piece, so every tile up to the rook must be empty. the king moves two tiles and the rook lands on the tile it crossed.
+		if (m_board[rook_position] == Side && m_board[rook_position] == TileType::Rook && (line_tables.m_between[square][rook_square] & m_board.get_occupancy()) == 0)
+			add<CastleCommand>(move_list, position, position + (2 * vector), rook_position, position + vector, vector);
+	}
+}
+
+template<class Command, class... Arguments>
+void Chess::MoveGenerator::add(MoveList& move_list, const Arguments... arguments) const
+{
+	Command command(arguments...);
+
+	if (command.validate(m_board))
+		move_list.push_back(std::make_unique<Command>(command));
+}
+
+template<class Command, class... Arguments>
+void Chess::MoveGenerator::add_legal(MoveList& move_list, const Arguments... arguments) const
+{
+	move_list.push_back(std::make_unique<Command>(arguments...));
+}
+
+template<class Command, class... Arguments>
+void Chess::MoveGenerator::add(MoveCounter& counter, const Arguments... arguments) const
+{
+	Command command(arguments...);
+
+	if (command.validate(m_board))
+		counter.m_count += get_variations<Command>();
+}
+
+template<class Command, class... Arguments>
+void Chess::MoveGenerator::add_legal(MoveCounter& counter, const Arguments...) const
+{
+	counter.m_count += get_variations<Command>();
+}
@@ -0,0 +1,105 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to generate the legal moves of a piece. There is no object per piece to ask, the piece's type is read off its tile and switched on, and its
+targets are read from the attack tables (the leapers) or stepped to along its scanning vectors (the bishop, rook and queen). A pinned piece may only move to the
+squares of its pin ray, and in check a piece other than the king may only take the checking piece or block it, both of which the board works out for the player
+to move before generating. Targets are masked against the two, so those moves need no validating, only the king's moves and enpassants are tried on the board. The same generation can
+count the moves instead, building no commands for the moves it already knows are legal. Every generator is compiled once per side, and the side to move is
+dispatched on once per call rather than once per piece. The check mask and pin rays are copied when the generator is made, so one generator can go on generating
+a position's moves after the board has searched below it and come back, without the board working them out again.
+*/
+
+#ifndef __MOVEGENERATOR_HEADER
+#define __MOVEGENERATOR_HEADER
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "Board.h"
+#include "MoveList.h"
+
+namespace Chess {
+
+	class MoveGenerator
+	{
+	public:
+		//the board must have been prepared for the player to move, see Board::prepare_move_generation.
+		MoveGenerator(Board& board, const MoveGeneration generation)
+			: m_board(board), m_generation(generation), m_check_mask(board.get_check_mask()), m_pin_rays(board.get_pin_rays()) {}
+		~MoveGenerator() {}
+
+		//generate another kind of move from the same position.
+		inline void set_generation(const MoveGeneration generation) { m_generation = generation; }
+
+		//the legal moves of every piece of the player to move, a movelist for each piece that has any.
+		void generate(std::vector<MoveList>& moves) const;
+		//the legal moves of the player's piece at the position.
+		MoveList generate(const int position) const;
+		//the number of legal moves of the player to move, a promotion once per promotion piece. the same moves are generated, but no commands are built for
+		//those already known to be legal, for bulk counting perft's last ply.
+		const int count() const;
+
+	private:
+
+		//the moves are either added to a movelist or only counted, the generation is the same.
+		struct MoveCounter
+		{
+			int m_count{ 0 };
+		};
+
+		//the side to move is dispatched on once, by the public methods above, then everything below is compiled for one side. the side's constants, e.g
+		//the pawn's direction, and its enemy are known when compiling.
+		template<Faction Side>
+		void generate_all(std::vector<MoveList>& moves) const;
+		template<Faction Side>
+		const int count_all() const;
+		template<Faction Side, class Output>
+		void generate_moves(const int position, Output& output) const;
+
+		template<Faction Side, class Output>
+		void generate_pawn_moves(const int position, Output& move_list) const;
+		template<Faction Side, class Output>
+		void generate_knight_moves(const int position, Output& move_list) const;
+		template<Faction Side, class Output>
+		void generate_scanning_moves(const int position, const TileType type, Output& move_list) const;
+		template<Faction Side, class Output>
+		void generate_king_moves(const int position, Output& move_list) const;
+
+		//add the command to the list if it is legal.
+		template<class Command, class... Arguments>
+		void add(MoveList& move_list, const Arguments... arguments) const;
+		//add a command already known to be legal, as it keeps to its piece's pin ray and answers any check.
+		template<class Command, class... Arguments>
+		void add_legal(MoveList& move_list, const Arguments... arguments) const;
+
+		//count the command if it is legal, the command is made to validate it but never kept.
+		template<class Command, class... Arguments>
+		void add(MoveCounter& counter, const Arguments... arguments) const;
+		//count a command already known to be legal, without making it.
+		template<class Command, class... Arguments>
+		void add_legal(MoveCounter& counter, const Arguments... arguments) const;
+
+		//a promotion is one command but a move per promotion piece.
+		template<class Command>
+		static constexpr int get_variations() { return std::is_base_of<PromotionCommand, Command>::value ? 4 : 1; }
+
+		//is the position one of the pin ray's squares? every position is on an unpinned piece's ray.
+		inline const bool is_on_ray(const std::uint64_t pin_ray, const int position) const { return ((pin_ray >> Board::Squares::squares[position]) & 1) != 0; }
+		inline const std::uint64_t get_pin_ray(const int position) const { return m_pin_rays[Board::Squares::squares[position]]; }
+
+		Board& m_board;
+		MoveGeneration m_generation;
+
+		//the board's, as they were when the generator was made.
+		std::uint64_t m_check_mask;
+		std::array<std::uint64_t, 64> m_pin_rays;
+	};
+}
+
+#endif
@@ -0,0 +1,154 @@
+#include "MovePicker.h"
+
+#include <algorithm>
+
+namespace {
+
+	//indexed by TileType, as in the search's evaluation.
+	constexpr int piece_values[] = { 0, 100, 320, 330, 500, 900, 0, 0 };
+
+	//a promotion gains a queen for the pawn.
+	constexpr int promotion_value{ 800 };
+}
+
+Chess::ChessCommandBase* Chess::MovePicker::next()
+{
+	while (m_index == m_stage_moves.size()) {
+
+		if (m_stage == PickerStage::Done)
+			return nullptr;
+
+		m_stage = static_cast<PickerStage>(static_cast<int>(m_stage) + 1);
+		m_stage_moves.clear();
+		m_index = 0;
+
+		//the board is only prepared once, the search below the node leaves its own check and pins on the board.
+		if (m_generator == nullptr) {
+
+			m_board.prepare_move_generation();
+			m_generator = std::make_unique<MoveGenerator>(m_board, MoveGeneration::All);
+		}
+
+		generate_stage();
+	}
+
+	return m_stage_moves[m_index++];
+}
+
+void Chess::MovePicker::generate_stage()
+{
+	switch (m_stage)
+	{
+	case PickerStage::HashMove:
+	{
+		if (m_hash_move.m_from == 0)
+			break;
+
+		//only the hash move's piece needs generating to find it.
+		MoveList& movelist{ keep(generate_piece_moves(m_hash_move.m_from, MoveGeneration::All)) };
+		const auto command{ movelist.find_in_list(m_hash_move.m_to) };
+
+		if (command != movelist.end()) {
+
+			m_stage_moves.push_back(command->get());
+			m_picked.push_back(command->get());
+		}
+		break;
+	}
+
+	case PickerStage::Captures:
+	{
+		for (auto& movelist : generate_moves(MoveGeneration::Captures)) {
+
+			for (auto& command : keep(std::move(movelist))) {
+
+				if (!is_picked(*command))
+					m_stage_moves.push_back(command.get());
+			}
+		}
+
+		//most valuable victim, then least valuable attacker. an enpassant's victim is a pawn off the destination tile.
+		const Board& board{ m_board };
+		auto score = [&board](const ChessCommandBase* command) {
+
+			const TileType victim{ board[command->get_to()].getTileType() };
+			const int victim_value{ (victim == TileType::Empty) ? piece_values[static_cast<int>(TileType::Pawn)] : piece_values[static_cast<int>(victim)] };
+
+			return (victim_value * 8) + (command->is_promotion() ? promotion_value * 8 : 0) - static_cast<int>(board[command->get_from()].getTileType());
+		};
+
+		std::stable_sort(m_stage_moves.begin(), m_stage_moves.end(), [&score](const ChessCommandBase* first, const ChessCommandBase* second) { return score(first) > score(second); });
+		break;
+	}
+
+	case PickerStage::Killers:
+	{
+		for (const Move& killer : m_killers) {
+
+			//killers are quiet moves from a sibling node, so they may not be legal here.
+			if (killer.m_from == 0 || (m_board[killer.m_to] != TileType::Empty))
+				continue;
+
+			MoveList& movelist{ keep(generate_piece_moves(killer.m_from, MoveGeneration::Quiets)) };
+			const auto command{ movelist.find_in_list(killer.m_to) };
+
+			if (command != movelist.end() && !is_picked(**command)) {
+
+				m_stage_moves.push_back(command->get());
+				m_picked.push_back(command->get());
+			}
+		}
+		break;
+	}
+
+	case PickerStage::Quiets:
+	{
+		for (auto& movelist : generate_moves(MoveGeneration::Quiets)) {
+
+			for (auto& command : keep(std::move(movelist))) {
+
+				if (!is_picked(*command))
+					m_stage_moves.push_back(command.get());
+			}
+		}
+		break;
+	}
+
+	default:
+		break;
+	}
+}
+
+Chess::MoveList Chess::MovePicker::generate_piece_moves(const int position, const MoveGeneration generation)
+{
+	//the hash move and killers were found in other positions, so the tile may not hold one of the player's pieces.
+	if (m_board[position] != m_board.get_player_faction())
+		return MoveList(position);
+
+	m_generator->set_generation(generation);
+	return m_generator->generate(position);
+}
+
+std::vector<Chess::MoveList> Chess::MovePicker::generate_moves(const MoveGeneration generation)
+{
+	std::vector<MoveList> moves;
+
+	m_generator->set_generation(generation);
+	m_generator->generate(moves);
+
+	return moves;
+}
+
+Chess::MoveList& Chess::MovePicker::keep(MoveList movelist)
+{
+	for (const auto& command : movelist)
+		m_generated_moves += command->is_promotion() ? 4 : 1;
+
+	m_movelists.push_back(std::move(movelist));
+	return m_movelists.back();
+}
+
+const bool Chess::MovePicker::is_picked(const ChessCommandBase& command) const
+{
+	return std::any_of(m_picked.begin(), m_picked.end(), [&command](const ChessCommandBase* picked) { return (picked->get_from() == command.get_from()) && (picked->get_to() == command.get_to()); });
+}
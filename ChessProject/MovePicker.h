@@ -0,0 +1,86 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to hand the search a node's moves one at a time, in the order they are most likely to cause a cut-off: the hash move, then captures (most
+valuable victim first), then the killer moves, then the remaining quiet moves. A stage is only generated once the search has used up the stage before it, so a node
+that is cut off early never generates or validates the moves it would not have searched. Check and pins are worked out once, when the first stage is generated,
+and every stage is generated by the same MoveGenerator, which keeps them while the search below the node moves the board about.
+*/
+
+#ifndef __MOVEPICKER_HEADER
+#define __MOVEPICKER_HEADER
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Board.h"
+#include "MoveGenerator.h"
+#include "MoveList.h"
+
+namespace Chess {
+
+	enum class PickerStage
+	{
+		Start,
+		HashMove,
+		Captures,
+		Killers,
+		Quiets,
+		Done
+	};
+
+	class MovePicker
+	{
+	public:
+		//the hash move and killers may be empty (m_from of zero), or not legal here, in which case they're skipped.
+		MovePicker(Board& board, const Move& hash_move, const Move& first_killer, const Move& second_killer)
+			: m_board(board), m_hash_move(hash_move), m_killers{ first_killer, second_killer } {}
+		~MovePicker() {}
+
+		//the next move to search, or nullptr once every stage is used up. commands stay valid for the life of the picker.
+		ChessCommandBase* next();
+
+		//the number of moves generated so far, promotions counted once per promotion piece.
+		inline const int get_generated_moves() const { return m_generated_moves; }
+
+	private:
+
+		void generate_stage();
+
+		//the legal moves of the player's piece at the position, an empty list if there isn't one.
+		MoveList generate_piece_moves(const int position, const MoveGeneration generation);
+		//the legal moves of every piece of the player, a movelist for each piece that has any.
+		std::vector<MoveList> generate_moves(const MoveGeneration generation);
+
+		//keep a generated movelist and count its moves.
+		MoveList& keep(MoveList movelist);
+
+		//has the move already been handed out by an earlier stage?
+		const bool is_picked(const ChessCommandBase& command) const;
+
+		Board& m_board;
+		//made when the first stage is generated, a node cut off by the hash move's stage never generates the others.
+		std::unique_ptr<MoveGenerator> m_generator;
+
+		Move m_hash_move;
+		Move m_killers[2];
+
+		PickerStage m_stage{ PickerStage::Start };
+
+		//every movelist generated, which own the commands handed out.
+		std::vector<MoveList> m_movelists;
+		std::vector<ChessCommandBase*> m_stage_moves;
+		std::size_t m_index{ 0 };
+
+		//the hash move and killers that were found legal, for skipping them in the later stages.
+		std::vector<const ChessCommandBase*> m_picked;
+
+		int m_generated_moves{ 0 };
+	};
+}
+
+#endif
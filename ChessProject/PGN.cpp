@@ -0,0 +1,170 @@
+#include "PGN.h"
+
+#include <cctype>
+#include <algorithm>
+
+const std::string_view PGNGame::get_tag(const std::string_view name) const
+{
+	for (const auto& tag : m_tags) {
+
+		if (tag.first == name)
+			return tag.second;
+	}
+
+	return std::string_view();
+}
+
+bool PGNReader::read_game(PGNGame& game)
+{
+	game.clear();
+	skip_whitespace();
+
+	if (m_position >= m_text.size())
+		return false;
+
+	game.m_index = ++m_game_count;
+
+	//the tag pair section.
+	while (m_position < m_text.size() && m_text[m_position] == '[') {
+
+		read_tag(game);
+		skip_whitespace();
+	}
+
+	//the movetext section, until the result or the start of the next game.
+	while (m_position < m_text.size()) {
+
+		const char c{ m_text[m_position] };
+
+		if (std::isspace(static_cast<unsigned char>(c))) {
+
+			++m_position;
+		}
+		else if (c == '[') {
+
+			//a missing result, the next game has started.
+			break;
+		}
+		else if (c == '{') {
+
+			const std::size_t end{ m_text.find('}', m_position) };
+			m_position = (end == std::string_view::npos) ? m_text.size() : end + 1;
+		}
+		else if (c == ';' || (c == '%' && (m_position == 0 || m_text[m_position - 1] == '\n'))) {
+
+			//comment or escape to the end of the line.
+			const std::size_t end{ m_text.find('\n', m_position) };
+			m_position = (end == std::string_view::npos) ? m_text.size() : end + 1;
+		}
+		else if (c == '(') {
+
+			//variations may nest and contain comments, skip the lot.
+			int depth{ 0 };
+
+			while (m_position < m_text.size()) {
+
+				const char v{ m_text[m_position] };
+
+				if (v == '{') {
+
+					const std::size_t end{ m_text.find('}', m_position) };
+					m_position = (end == std::string_view::npos) ? m_text.size() : end;
+				}
+				else if (v == '(') {
+
+					++depth;
+				}
+				else if (v == ')' && --depth == 0) {
+
+					++m_position;
+					break;
+				}
+				++m_position;
+			}
+		}
+		else if (c == '$' || c == ')') {
+
+			//annotation glyph (or a stray close), skip the token.
+			++m_position;
+			while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position])))
+				++m_position;
+		}
+		else if (is_token("1-0") || is_token("0-1") || is_token("1/2-1/2") || is_token("*")) {
+
+			std::size_t end{ m_position };
+			while (!is_delimiter(end))
+				++end;
+
+			game.m_result = m_text.substr(m_position, end - m_position);
+			m_position = end;
+			break;
+		}
+		else if (std::isdigit(static_cast<unsigned char>(c)) && !is_token("0-0") && !is_token("0-0-0")) {
+
+			//a move number, e.g. '12.' or '12...', possibly glued to the move that follows.
+			while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position])))
+				++m_position;
+			while (m_position < m_text.size() && m_text[m_position] == '.')
+				++m_position;
+		}
+		else {
+
+			//a move in standard algebraic notation.
+			const std::size_t start{ m_position };
+
+			while (!is_delimiter(m_position))
+				++m_position;
+
+			game.m_moves.push_back(m_text.substr(start, m_position - start));
+		}
+	}
+
+	return true;
+}
+
+void PGNReader::skip_whitespace()
+{
+	while (m_position < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+		++m_position;
+}
+
+void PGNReader::read_tag(PGNGame& game)
+{
+	//[Name "Value"], the value may contain escaped quotes.
+	const std::size_t line_end{ std::min(m_text.find('\n', m_position), m_text.size()) };
+	const std::size_t name_start{ m_position + 1 };
+	std::size_t name_end{ name_start };
+
+	while (name_end < line_end && !std::isspace(static_cast<unsigned char>(m_text[name_end])) && m_text[name_end] != '"')
+		++name_end;
+
+	std::size_t value_start{ m_text.find('"', name_end) };
+	std::size_t value_end{ value_start };
+
+	if (value_start != std::string_view::npos && value_start < line_end) {
+
+		++value_start;
+		value_end = value_start;
+
+		while (value_end < line_end && !(m_text[value_end] == '"' && m_text[value_end - 1] != '\\'))
+			++value_end;
+
+		game.m_tags.emplace_back(m_text.substr(name_start, name_end - name_start), m_text.substr(value_start, value_end - value_start));
+	}
+
+	m_position = line_end;
+}
+
+const bool PGNReader::is_token(const std::string_view token) const
+{
+	return (m_text.compare(m_position, token.size(), token) == 0) && is_delimiter(m_position + token.size());
+}
+
+const bool PGNReader::is_delimiter(const std::size_t position) const
+{
+	if (position >= m_text.size())
+		return true;
+
+	const char c{ m_text[position] };
+	return std::isspace(static_cast<unsigned char>(c)) || c == '{' || c == '(' || c == ')' || c == ';' || c == '[' || c == '$';
+}
@@ -0,0 +1,62 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class implements a zero-copy reader of Portable Game Notation (PGN) archives. Games are tokenised in place, every tag and move is a string_view into the
+text being read (typically a MappedFile), so reading a game never copies any of its text.
+
+Portable Game Notation:
+each game begins with tag pairs, one per line: [Name "Value"], e.g: [White "Carlsen, Magnus"] or [FEN "..."] for games not starting from the standard position.
+the movetext follows: moves in standard algebraic notation (SAN), optionally numbered (1. e4 e5 2. Nf3), and is terminated by the result: 1-0, 0-1, 1/2-1/2 or *.
+the movetext may also contain {comments}, ;comments to the end of the line, (variations) and $n annotation glyphs, which the reader skips.
+*/
+
+#ifndef __PGN_HEADER
+#define __PGN_HEADER
+
+#include <string_view>
+#include <vector>
+#include <utility>
+
+struct PGNGame
+{
+	//position of the game in the archive, counting from 1.
+	std::size_t m_index{ 0 };
+
+	std::vector<std::pair<std::string_view, std::string_view>> m_tags;
+	std::vector<std::string_view> m_moves;
+	std::string_view m_result;
+
+	//the value of a tag, empty if the game does not have it.
+	const std::string_view get_tag(const std::string_view name) const;
+
+	void clear() { m_index = 0; m_tags.clear(); m_moves.clear(); m_result = std::string_view(); }
+};
+
+class PGNReader
+{
+public:
+	//the text must outlive both the reader and every game it reads.
+	PGNReader(const std::string_view text) : m_text(text) {}
+	~PGNReader() {}
+
+	//read the next game, returns false once the text is exhausted.
+	bool read_game(PGNGame& game);
+
+private:
+
+	void skip_whitespace();
+	void read_tag(PGNGame& game);
+
+	//true if the text at the current position is the given token followed by a delimiter.
+	const bool is_token(const std::string_view token) const;
+	const bool is_delimiter(const std::size_t position) const;
+
+	std::string_view m_text;
+	std::size_t m_position{ 0 };
+	std::size_t m_game_count{ 0 };
+};
+
+#endif
@@ -0,0 +1,147 @@
+#include "PGNReplayer.h"
+
+#include <thread>
+#include <chrono>
+#include <algorithm>
+
+#include "BoundedQueue.h"
+#include "Board.h"
+
+namespace {
+
+	//the results of a batch of games, passed from the replay stage to the reporting stage.
+	struct ReplayResults
+	{
+		std::size_t m_games{ 0 };
+		std::size_t m_plies{ 0 };
+		std::vector<std::pair<std::size_t, std::string>> m_invalid_games;
+	};
+}
+
+Chess::PGNReplayer::PGNReplayer(const unsigned int thread_count) : m_thread_count(std::max(1u, thread_count)) {}
+
+const bool Chess::PGNReplayer::run(const std::string_view archive, std::ostream& report)
+{
+	BoundedQueue<std::vector<PGNGame>> games(2 * m_thread_count);
+	BoundedQueue<ReplayResults> results(2 * m_thread_count);
+
+	const auto start = std::chrono::steady_clock::now();
+
+	//replay stage.
+	std::vector<std::thread> workers;
+	for (unsigned int i{ 0 }; i < m_thread_count; ++i) {
+
+		workers.emplace_back([this, &games, &results]() {
+
+			std::vector<PGNGame> batch;
+			while (games.pop(batch)) {
+
+				ReplayResults batch_results;
+				std::string error;
+
+				for (const auto& game : batch) {
+
+					++batch_results.m_games;
+					batch_results.m_plies += replay_game(game, error);
+
+					if (!error.empty()) {
+
+						batch_results.m_invalid_games.emplace_back(game.m_index, std::move(error));
+						error.clear();
+					}
+				}
+
+				results.push(std::move(batch_results));
+			}
+		});
+	}
+
+	//reporting stage.
+	std::size_t game_count{ 0 };
+	std::size_t ply_count{ 0 };
+	std::size_t invalid_count{ 0 };
+
+	std::thread reporter([&results, &report, &game_count, &ply_count, &invalid_count]() {
+
+		ReplayResults batch_results;
+		while (results.pop(batch_results)) {
+
+			game_count += batch_results.m_games;
+			ply_count += batch_results.m_plies;
+			invalid_count += batch_results.m_invalid_games.size();
+
+			for (const auto& invalid_game : batch_results.m_invalid_games)
+				report << "INVALID game " << invalid_game.first << ": " << invalid_game.second << "\n";
+		}
+	});
+
+	//parsing stage, on the calling thread.
+	PGNReader reader(archive);
+	std::vector<PGNGame> batch(batch_size);
+	std::size_t batch_count{ 0 };
+
+	while (reader.read_game(batch[batch_count])) {
+
+		if (++batch_count == batch_size) {
+
+			games.push(std::move(batch));
+			batch = std::vector<PGNGame>(batch_size);
+			batch_count = 0;
+		}
+	}
+
+	if (batch_count != 0) {
+
+		batch.resize(batch_count);
+		games.push(std::move(batch));
+	}
+
+	games.close();
+	for (auto& worker : workers)
+		worker.join();
+
+	results.close();
+	reporter.join();
+
+	const double elapsed{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+	report << "\nPGN replay: " << game_count << " games, " << (game_count - invalid_count) << " valid, " << invalid_count << " invalid, " << ply_count << " plies.\n"
+		<< "Total time " << elapsed << "s on " << m_thread_count << " threads, " << (game_count / elapsed) << " games/s, " << (ply_count / elapsed) << " plies/s.\n";
+
+	return invalid_count == 0;
+}
+
+const std::size_t Chess::PGNReplayer::replay_game(const PGNGame& game, std::string& error) const
+{
+	std::size_t plies{ 0 };
+
+	//a malformed game is reported as invalid, it must not stop the rest of the archive.
+	try {
+
+		//games that don't start from the standard position give their own FEN.
+		const std::string_view fen{ game.get_tag("FEN") };
+		Board board{ FEN(fen.empty() ? std::string(FEN::standard_position) : std::string(fen)) };
+
+		for (const auto san : game.m_moves) {
+
+			board.generate_legal_moves();
+			const auto move = board.find_san_move(san);
+
+			if (!move.first) {
+
+				error = "illegal or ambiguous move '" + std::string(san) + "' at ply " + std::to_string(plies + 1) + ".";
+				return plies;
+			}
+
+			board.find_and_execute_move(move.second);
+			board.rotate_players();
+			++plies;
+		}
+	}
+	catch (std::exception& e) {
+
+		error = e.what();
+	}
+
+	return plies;
+}
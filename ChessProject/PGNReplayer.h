@@ -0,0 +1,45 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to replay and validate whole PGN archives. It is a three stage pipeline connected by bounded queues: the calling thread tokenises the archive into
+batches of games, a pool of worker threads replays each game on its own board, resolving every SAN move against the legal moves, and a reporting thread gathers
+the results. The bounded queues keep the stages in step, so memory use stays flat however large the archive is.
+*/
+
+#ifndef __PGNREPLAYER_HEADER
+#define __PGNREPLAYER_HEADER
+
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <vector>
+
+#include "PGN.h"
+
+namespace Chess {
+
+	class PGNReplayer
+	{
+	public:
+		PGNReplayer(const unsigned int thread_count);
+		~PGNReplayer() {}
+
+		//replay every game of the archive, invalid games are reported as they are found and a summary at the end. Returns true if every game was valid.
+		const bool run(const std::string_view archive, std::ostream& report);
+
+	private:
+
+		//replay one game on its own board, returning the number of plies replayed, or an explanation of why the game is invalid.
+		const std::size_t replay_game(const PGNGame& game, std::string& error) const;
+
+		unsigned int m_thread_count;
+
+		//games are handed between the stages in batches, which keeps queue traffic low.
+		static constexpr std::size_t batch_size{ 256 };
+	};
+}
+
+#endif
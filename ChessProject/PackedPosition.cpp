@@ -0,0 +1,10 @@
+#include "PackedPosition.h"
+
+#include <stdexcept>
+
+PackedPositionFile::PackedPositionFile(const std::string& path) : m_file(path), m_size(m_file.size() / PackedPosition::size)
+{
+	//a partial record means the file is not a packed position file, or is truncated.
+	if ((m_file.size() % PackedPosition::size) != 0)
+		throw std::runtime_error("Invalid packed position file! The size is not a whole number of records: " + path);
+}
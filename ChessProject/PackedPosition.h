@@ -0,0 +1,117 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves as a fixed-size, 32 byte binary encoding of a chess position for storing large datasets. It is roughly a third of the size of the equivalent
+FEN text and is decoded without any text parsing. A file of packed positions is simply the records back to back, and is read through a memory mapping.
+
+Layout (multi-byte fields are little-endian):
+bytes 0-7:   occupancy mask, bit n is set if square n is occupied. squares are numbered 0 (a8) to 63 (h1), in the same order FEN lists them.
+bytes 8-23:  one 4-bit piece code per occupied square, in square order, low nibble first. codes are the TileType (1 pawn ... 6 king), plus 8 for black.
+byte 24:     bit 0 is the player to move (1 = black), bits 1-4 are the castling permissions (K = 1, Q = 2, k = 4, q = 8, as in Board::get_castle_permissions).
+byte 25:     the FEN enpassant square (0-63), or 255 if there is none.
+bytes 26-27: half move clock.
+bytes 28-29: full move clock.
+bytes 30-31: reserved, zero.
+*/
+
+#ifndef __PACKEDPOSITION_HEADER
+#define __PACKEDPOSITION_HEADER
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "MappedFile.h"
+
+struct PackedPosition
+{
+	static constexpr std::size_t size{ 32 };
+	static constexpr int max_pieces{ 32 };
+	static constexpr int no_enpassant{ 255 };
+
+	std::array<std::uint8_t, size> m_bytes{};
+
+	const std::uint64_t get_occupancy() const { return read(0, 8); }
+	void set_occupancy(const std::uint64_t occupancy) { write(0, 8, occupancy); }
+
+	const int get_piece_code(const int index) const { return (m_bytes[8 + (index / 2)] >> ((index % 2) * 4)) & 0xF; }
+	void set_piece_code(const int index, const int code) { m_bytes[8 + (index / 2)] |= static_cast<std::uint8_t>((code & 0xF) << ((index % 2) * 4)); }
+
+	const bool is_black_to_play() const { return (m_bytes[24] & 1) != 0; }
+	const int get_castle_permissions() const { return (m_bytes[24] >> 1) & 0xF; }
+	void set_flags(const bool black_to_play, const int castle_permissions) { m_bytes[24] = static_cast<std::uint8_t>((black_to_play ? 1 : 0) | ((castle_permissions & 0xF) << 1)); }
+
+	const int get_enpassant_square() const { return m_bytes[25]; }
+	void set_enpassant_square(const int square) { m_bytes[25] = static_cast<std::uint8_t>(square); }
+
+	const int get_half_move_clock() const { return static_cast<int>(read(26, 2)); }
+	void set_half_move_clock(const int clock) { write(26, 2, static_cast<std::uint64_t>(clock)); }
+
+	const int get_full_move_clock() const { return static_cast<int>(read(28, 2)); }
+	void set_full_move_clock(const int clock) { write(28, 2, static_cast<std::uint64_t>(clock)); }
+
+private:
+
+	//byte-wise, so the format is the same on every platform.
+	const std::uint64_t read(const std::size_t offset, const std::size_t length) const
+	{
+		std::uint64_t value{ 0 };
+		for (std::size_t i{ 0 }; i < length; ++i)
+			value |= static_cast<std::uint64_t>(m_bytes[offset + i]) << (8 * i);
+		return value;
+	}
+
+	void write(const std::size_t offset, const std::size_t length, const std::uint64_t value)
+	{
+		for (std::size_t i{ 0 }; i < length; ++i)
+			m_bytes[offset + i] = static_cast<std::uint8_t>(value >> (8 * i));
+	}
+};
+static_assert(sizeof(PackedPosition) == PackedPosition::size, "Packed positions must be exactly 32 bytes!");
+
+//a read-only, memory mapped file of packed positions.
+class PackedPositionFile
+{
+public:
+	PackedPositionFile(const std::string& path);
+	~PackedPositionFile() {}
+
+	inline const std::size_t size() const { return m_size; }
+
+	//records are copied out of the mapping, as the mapping makes no alignment promises.
+	const PackedPosition operator[](const std::size_t index) const
+	{
+		PackedPosition position;
+		std::memcpy(position.m_bytes.data(), m_file.view().data() + (index * PackedPosition::size), PackedPosition::size);
+		return position;
+	}
+
+	//forward iteration over the records for range-based for loops.
+	class const_iterator
+	{
+	public:
+		const_iterator(const PackedPositionFile& file, const std::size_t index) : m_file(&file), m_index(index) {}
+
+		const PackedPosition operator*() const { return (*m_file)[m_index]; }
+		const_iterator& operator++() { ++m_index; return *this; }
+		const bool operator!=(const const_iterator& iterator) const { return m_index != iterator.m_index; }
+
+	private:
+		const PackedPositionFile* m_file;
+		std::size_t m_index;
+	};
+
+	const_iterator begin() const { return const_iterator(*this, 0); }
+	const_iterator end() const { return const_iterator(*this, m_size); }
+
+private:
+
+	MappedFile m_file;
+	std::size_t m_size;
+};
+
+#endif
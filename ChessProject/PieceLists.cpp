@@ -0,0 +1,91 @@
+#include "PieceLists.h"
+
+#include <cassert>
+
+void Chess::PieceLists::clear()
+{
+	for (auto& side : m_lists)
+		for (auto& piece_list : side)
+			piece_list.m_count = 0;
+
+	m_occupancy.fill(0);
+}
+
+void Chess::PieceLists::push_back(const Tile tile, const int position, const int move_count)
+{
+	PieceList& piece_list{ list(tile) };
+
+	assert(piece_list.m_count < PieceList::capacity && "Piece list is full!");
+
+	m_indices[position] = static_cast<std::uint8_t>(piece_list.m_count);
+	piece_list.m_positions[piece_list.m_count] = static_cast<std::uint8_t>(position);
+	piece_list.m_move_counts[piece_list.m_count] = static_cast<std::uint16_t>(move_count);
+	++piece_list.m_count;
+
+	m_occupancy[get_side(tile.getFaction())] |= get_bit(position);
+}
+
+void Chess::PieceLists::move(const Tile tile, const int from, const int to)
+{
+	PieceList& piece_list{ list(tile) };
+	const int index{ m_indices[from] };
+
+	piece_list.m_positions[index] = static_cast<std::uint8_t>(to);
+	++piece_list.m_move_counts[index];
+	m_indices[to] = static_cast<std::uint8_t>(index);
+
+	m_occupancy[get_side(tile.getFaction())] ^= get_bit(from) | get_bit(to);
+}
+
+void Chess::PieceLists::undo_move(const Tile tile, const int from, const int to)
+{
+	PieceList& piece_list{ list(tile) };
+	const int index{ m_indices[from] };
+
+	piece_list.m_positions[index] = static_cast<std::uint8_t>(to);
+	--piece_list.m_move_counts[index];
+	m_indices[to] = static_cast<std::uint8_t>(index);
+
+	m_occupancy[get_side(tile.getFaction())] ^= get_bit(from) | get_bit(to);
+}
+
+const int Chess::PieceLists::remove(const Tile tile, const int position)
+{
+	PieceList& piece_list{ list(tile) };
+	const int index{ m_indices[position] };
+	const int last{ --piece_list.m_count };
+
+	assert(piece_list.m_positions[index] == position && "Piece was not found in its list!");
+
+	//the last piece fills the gap, unless it was the last piece.
+	if (index != last) {
+
+		piece_list.m_positions[index] = piece_list.m_positions[last];
+		piece_list.m_move_counts[index] = piece_list.m_move_counts[last];
+		m_indices[piece_list.m_positions[index]] = static_cast<std::uint8_t>(index);
+	}
+
+	m_occupancy[get_side(tile.getFaction())] &= ~get_bit(position);
+
+	return index;
+}
+
+void Chess::PieceLists::insert(const Tile tile, const int position, const int index, const int move_count)
+{
+	PieceList& piece_list{ list(tile) };
+	const int last{ piece_list.m_count++ };
+
+	//the piece that filled the gap goes back to the end. past the end of the list is stale, so there is nothing to move if the piece was the last.
+	if (index != last) {
+
+		piece_list.m_positions[last] = piece_list.m_positions[index];
+		piece_list.m_move_counts[last] = piece_list.m_move_counts[index];
+		m_indices[piece_list.m_positions[last]] = static_cast<std::uint8_t>(last);
+	}
+
+	piece_list.m_positions[index] = static_cast<std::uint8_t>(position);
+	piece_list.m_move_counts[index] = static_cast<std::uint16_t>(move_count);
+	m_indices[position] = static_cast<std::uint8_t>(index);
+
+	m_occupancy[get_side(tile.getFaction())] |= get_bit(position);
+}
@@ -0,0 +1,85 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to keep track of where every piece is. Rather than an object per piece, each side has a list per piece type, and each list is a fixed array of
+the positions its pieces stand on, beside an array of how many times each has moved. Generating a type's moves is a loop over one short array, and nothing in here
+is ever allocated after the board is made. A piece taken off its list leaves the last piece of the list in its place, and is put back by reversing exactly that,
+so the lists are in the same order after a move is unmade as they were before it was made. Each side's occupancy is kept alongside as a bit per square, to mask
+the line tables against.
+*/
+
+#ifndef __PIECELISTS_HEADER
+#define __PIECELISTS_HEADER
+
+#include <array>
+#include <cstdint>
+
+#include "BoardBase.h"
+#include "Tile.h"
+
+namespace Chess {
+
+	//the pieces of one type belonging to one side.
+	struct PieceList
+	{
+		//a side has at most sixteen pieces, so no list can hold more.
+		static constexpr int capacity{ 16 };
+
+		std::uint8_t m_positions[capacity]{};
+		std::uint16_t m_move_counts[capacity]{};
+		int m_count{ 0 };
+
+		const std::uint8_t* begin() const { return m_positions; }
+		const std::uint8_t* end() const { return m_positions + m_count; }
+	};
+
+	class PieceLists
+	{
+	public:
+		PieceLists() {}
+		~PieceLists() {}
+
+		void clear();
+
+		//the list of a side's pieces of a type, e.g get(Faction::White, TileType::Knight).
+		inline const PieceList& get(const Faction faction, const TileType type) const { return m_lists[get_side(faction)][static_cast<int>(type)]; }
+		inline const int size(const Faction faction, const TileType type) const { return get(faction, type).m_count; }
+
+		//the tile is the piece's tile on the board, which says which list it is in.
+		void push_back(const Tile tile, const int position, const int move_count = 0);
+		void move(const Tile tile, const int from, const int to);
+		void undo_move(const Tile tile, const int from, const int to);
+
+		//take a piece off its list, and put it back at the index it had, which remove returns.
+		const int remove(const Tile tile, const int position);
+		void insert(const Tile tile, const int position, const int index, const int move_count);
+
+		inline const int get_move_count(const Tile tile, const int position) const { return list(tile).m_move_counts[m_indices[position]]; }
+
+		//the squares a side's pieces stand on, or either side's, a8 is bit 0.
+		inline const std::uint64_t get_occupancy(const Faction faction) const { return m_occupancy[get_side(faction)]; }
+		inline const std::uint64_t get_occupancy() const { return m_occupancy[0] | m_occupancy[1]; }
+
+	private:
+
+		inline static constexpr int get_side(const Faction faction) { return (faction == Faction::Black) ? 1 : 0; }
+		inline static constexpr std::uint64_t get_bit(const int position) { return std::uint64_t(1) << BoardBase<10, 12, Tile>::Squares::squares[position]; }
+
+		inline PieceList& list(const Tile tile) { return m_lists[get_side(tile.getFaction())][static_cast<int>(tile.getTileType())]; }
+		inline const PieceList& list(const Tile tile) const { return m_lists[get_side(tile.getFaction())][static_cast<int>(tile.getTileType())]; }
+
+		//indexed by side, white (0) or black (1), then TileType. the empty and border types are never used.
+		std::array<std::array<PieceList, 8>, 2> m_lists{};
+
+		//the index of the piece on each position within its list, only meaningful where there is a piece.
+		std::array<std::uint8_t, 120> m_indices{};
+
+		//indexed by side, white (0) or black (1).
+		std::array<std::uint64_t, 2> m_occupancy{};
+	};
+}
+
+#endif
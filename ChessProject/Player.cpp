@@ -6,6 +6,20 @@ void Chess::Player::add_castle_permission(const int vector, const bool permissio
 {
 	m_castle_permissions.push_back(std::pair<int, bool>(vector, permission));
 }
+
+void Chess::Player::set_castle_permission(const int vector, const bool permission)
+{
+	for (auto& castle_permission : m_castle_permissions) {
+
+		if (castle_permission.first == vector) {
+
+			castle_permission.second = permission;
+			return;
+		}
+	}
+
+	add_castle_permission(vector, permission);
+}
  
 const bool Chess::Player::can_castle_in_vector(const int vector) const
 {
@@ -27,6 +27,7 @@ namespace Chess {
 		~Player() {}
 
 		void add_castle_permission(const int vector, const bool permission);
+		void set_castle_permission(const int vector, const bool permission);
 		const bool can_castle_in_vector(const int vector) const;
 
 		//harmlessly expose this for printing
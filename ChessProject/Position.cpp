@@ -0,0 +1,351 @@
+#include "Position.h"
+
+namespace {
+
+	using TileVector = Chess::Position::TileVector;
+	using Squares = Chess::Position::Squares;
+
+	constexpr int bishop_vectors[] = { TileVector::north_east, TileVector::south_east, TileVector::south_west, TileVector::north_west };
+	constexpr int rook_vectors[] = { TileVector::north, TileVector::east, TileVector::south, TileVector::west };
+
+	//the castling permissions that survive a move from or to each tile: a8 = 21, e8 = 25, h8 = 28, a1 = 91, e1 = 95, h1 = 98.
+	constexpr std::array<std::uint8_t, 120> generate_castle_masks()
+	{
+		std::array<std::uint8_t, 120> masks{};
+
+		for (auto& mask : masks)
+			mask = 15;
+
+		masks[21] = static_cast<std::uint8_t>(~8 & 15);
+		masks[25] = static_cast<std::uint8_t>(~(4 | 8) & 15);
+		masks[28] = static_cast<std::uint8_t>(~4 & 15);
+		masks[91] = static_cast<std::uint8_t>(~2 & 15);
+		masks[95] = static_cast<std::uint8_t>(~(1 | 2) & 15);
+		masks[98] = static_cast<std::uint8_t>(~1 & 15);
+
+		return masks;
+	}
+
+	constexpr std::array<std::uint8_t, 120> castle_masks{ generate_castle_masks() };
+
+	//the promotion pieces, queen first.
+	constexpr char white_promotion_notation[] = { 'Q', 'R', 'B', 'N' };
+	constexpr char black_promotion_notation[] = { 'q', 'r', 'b', 'n' };
+
+	//the piece code of a side's piece of the given type.
+	template<Chess::Faction Side>
+	constexpr std::uint8_t piece_code(const Chess::TileType tile_type)
+	{
+		return static_cast<std::uint8_t>(static_cast<int>(tile_type) | (Chess::FactionTraits<Side>::is_white ? 0 : Chess::Position::black));
+	}
+
+	constexpr int get_row(const int position) { return Squares::squares[position] / Squares::game_board_x; }
+}
+
+const int Chess::Position::generate_moves(Move* moves) const
+{
+	return (m_black_to_play != 0) ? generate_legal_moves<Faction::Black>(moves, false) : generate_legal_moves<Faction::White>(moves, false);
+}
+
+const bool Chess::Position::has_legal_move() const
+{
+	Move moves[max_moves];
+	return ((m_black_to_play != 0) ? generate_legal_moves<Faction::Black>(moves, true) : generate_legal_moves<Faction::White>(moves, true)) != 0;
+}
+
+const int Chess::Position::count_moves() const
+{
+	Move moves[max_moves];
+	return generate_moves(moves);
+}
+
+void Chess::Position::make_move(const Move& move)
+{
+	if (m_black_to_play != 0)
+		make_move<Faction::Black>(move);
+	else
+		make_move<Faction::White>(move);
+}
+
+const bool Chess::Position::is_attacked(const int position, const bool by_black) const
+{
+	return by_black ? is_attacked<Faction::Black>(position) : is_attacked<Faction::White>(position);
+}
+
+const std::uint64_t Chess::Position::perft(const int depth) const
+{
+	return (m_black_to_play != 0) ? perft<Faction::Black>(depth) : perft<Faction::White>(depth);
+}
+
+template<Chess::Faction Side>
+const int Chess::Position::generate_legal_moves(Move* moves, const bool first_only) const
+{
+	using Traits = FactionTraits<Side>;
+
+	const int pseudo_legal_count{ generate_pseudo_legal_moves<Side>(moves) };
+	int count{ 0 };
+
+	//keep the moves that don't leave the mover's king attacked.
+	for (int i{ 0 }; i < pseudo_legal_count; ++i) {
+
+		Position child{ *this };
+		child.make_move<Side>(moves[i]);
+
+		if (child.is_attacked<Traits::enemy>(child.m_king_positions[Traits::index]))
+			continue;
+
+		moves[count++] = moves[i];
+
+		if (first_only)
+			break;
+	}
+
+	return count;
+}
+
+template<Chess::Faction Side>
+void Chess::Position::make_move(const Move& move)
+{
+	using Traits = FactionTraits<Side>;
+
+	const std::uint8_t piece{ m_tiles[move.m_from] };
+	const TileType tile_type{ static_cast<TileType>(piece & 7) };
+
+	const bool is_capture{ !is_empty(move.m_to) };
+
+	m_tiles[move.m_to] = piece;
+	m_tiles[move.m_from] = 0;
+
+	if (tile_type == TileType::Pawn) {
+
+		//an enpassant capture takes the pawn behind the destination.
+		if (move.m_to == m_enpassant_position)
+			m_tiles[move.m_to - Traits::forward] = 0;
+
+		if (move.m_promotion != 0) {
+
+			TileType promotion{ TileType::Queen };
+
+			switch (move.m_promotion)
+			{
+			case 'N': case 'n': promotion = TileType::Knight; break;
+			case 'B': case 'b': promotion = TileType::Bishop; break;
+			case 'R': case 'r': promotion = TileType::Rook; break;
+			default: break;
+			}
+
+			m_tiles[move.m_to] = piece_code<Side>(promotion);
+		}
+	}
+	else if (tile_type == TileType::King) {
+
+		m_king_positions[Traits::index] = static_cast<std::uint8_t>(move.m_to);
+
+		//castling moves the king two tiles, the rook jumps to the tile it crossed.
+		if (move.m_to - move.m_from == 2 * TileVector::east) {
+
+			m_tiles[move.m_from + TileVector::east] = m_tiles[move.m_from + (3 * TileVector::east)];
+			m_tiles[move.m_from + (3 * TileVector::east)] = 0;
+		}
+		else if (move.m_to - move.m_from == 2 * TileVector::west) {
+
+			m_tiles[move.m_from + TileVector::west] = m_tiles[move.m_from + (4 * TileVector::west)];
+			m_tiles[move.m_from + (4 * TileVector::west)] = 0;
+		}
+	}
+
+	m_castle_permissions &= castle_masks[move.m_from] & castle_masks[move.m_to];
+
+	m_enpassant_position = ((tile_type == TileType::Pawn) && (move.m_to - move.m_from == 2 * Traits::forward)) ? static_cast<std::uint8_t>(move.m_from + Traits::forward) : 0;
+
+	m_half_move_clock = ((tile_type == TileType::Pawn) || is_capture) ? 0 : static_cast<std::uint16_t>(m_half_move_clock + 1);
+
+	if (!Traits::is_white)
+		++m_full_move_clock;
+
+	m_black_to_play ^= 1;
+}
+
+template<Chess::Faction Attacker>
+const bool Chess::Position::is_attacked(const int position) const
+{
+	using Traits = FactionTraits<Attacker>;
+
+	constexpr std::uint8_t pawn{ piece_code<Attacker>(TileType::Pawn) };
+	constexpr std::uint8_t knight{ piece_code<Attacker>(TileType::Knight) };
+	constexpr std::uint8_t bishop{ piece_code<Attacker>(TileType::Bishop) };
+	constexpr std::uint8_t rook{ piece_code<Attacker>(TileType::Rook) };
+	constexpr std::uint8_t queen{ piece_code<Attacker>(TileType::Queen) };
+
+	const int square{ Squares::squares[position] };
+
+	//pawns attack diagonally forward, so they attack from the tiles a pawn of the other side would attack.
+	for (const int attacker : leaper_attacks.m_pawn[FactionTraits<Traits::enemy>::index][square])
+		if (m_tiles[attacker] == pawn)
+			return true;
+
+	for (const int attacker : leaper_attacks.m_knight[square])
+		if (m_tiles[attacker] == knight)
+			return true;
+
+	//there is only one king, so test its square against the mask.
+	if (leaper_attacks.m_king[square].contains_square(Squares::squares[m_king_positions[Traits::index]]))
+		return true;
+
+	for (const int vector : bishop_vectors) {
+
+		int destination{ position + vector };
+		while (is_empty(destination))
+			destination += vector;
+
+		if (m_tiles[destination] == bishop || m_tiles[destination] == queen)
+			return true;
+	}
+
+	for (const int vector : rook_vectors) {
+
+		int destination{ position + vector };
+		while (is_empty(destination))
+			destination += vector;
+
+		if (m_tiles[destination] == rook || m_tiles[destination] == queen)
+			return true;
+	}
+
+	return false;
+}
+
+template<Chess::Faction Side>
+const std::uint64_t Chess::Position::perft(const int depth) const
+{
+	if (depth == 0)
+		return 1;
+
+	Move moves[max_moves];
+	const int count{ generate_legal_moves<Side>(moves, false) };
+
+	//the last ply only needs counting.
+	if (depth == 1)
+		return static_cast<std::uint64_t>(count);
+
+	std::uint64_t nodes{ 0 };
+
+	for (int i{ 0 }; i < count; ++i) {
+
+		//the next ply's slot is a copy, so nothing needs undoing afterwards.
+		Position child{ *this };
+		child.make_move<Side>(moves[i]);
+		nodes += child.perft<FactionTraits<Side>::enemy>(depth - 1);
+	}
+
+	return nodes;
+}
+
+template<Chess::Faction Side>
+const int Chess::Position::generate_pseudo_legal_moves(Move* moves) const
+{
+	using Traits = FactionTraits<Side>;
+
+	int count{ 0 };
+
+	auto add = [moves, &count](const int from, const int to) { moves[count++] = Move{ from, to, 0 }; };
+
+	for (int from{ 21 }; from <= 98; ++from) {
+
+		const std::uint8_t piece{ m_tiles[from] };
+
+		//the side's own pieces are the ones which are neither empty, border nor enemy.
+		if (piece == 0 || piece == border || is_enemy_of<Side>(from))
+			continue;
+
+		switch (static_cast<TileType>(piece & 7))
+		{
+		case TileType::Pawn:
+		{
+			const int destination{ from + Traits::forward };
+
+			if (is_empty(destination)) {
+
+				add_pawn_move<Side>(moves, count, from, destination);
+
+				if ((get_row(from) == Traits::pawn_start_row) && is_empty(destination + Traits::forward))
+					add(from, destination + Traits::forward);
+			}
+
+			for (const int capture : leaper_attacks.m_pawn[Traits::index][Squares::squares[from]]) {
+
+				if (is_enemy_of<Side>(capture) || (capture == m_enpassant_position && m_enpassant_position != 0))
+					add_pawn_move<Side>(moves, count, from, capture);
+			}
+			break;
+		}
+
+		case TileType::Knight:
+			for (const int destination : leaper_attacks.m_knight[Squares::squares[from]])
+				if (is_empty(destination) || is_enemy_of<Side>(destination))
+					add(from, destination);
+			break;
+
+		case TileType::King:
+			for (const int destination : leaper_attacks.m_king[Squares::squares[from]])
+				if (is_empty(destination) || is_enemy_of<Side>(destination))
+					add(from, destination);
+
+			//castling needs the tiles to the rook empty, and the king not to start on, pass or land on an attacked tile.
+			if ((m_castle_permissions & Traits::king_side_castle) && is_empty(from + 1) && is_empty(from + 2)
+				&& !is_attacked<Traits::enemy>(from) && !is_attacked<Traits::enemy>(from + 1) && !is_attacked<Traits::enemy>(from + 2))
+				add(from, from + 2);
+
+			if ((m_castle_permissions & Traits::queen_side_castle) && is_empty(from - 1) && is_empty(from - 2) && is_empty(from - 3)
+				&& !is_attacked<Traits::enemy>(from) && !is_attacked<Traits::enemy>(from - 1) && !is_attacked<Traits::enemy>(from - 2))
+				add(from, from - 2);
+			break;
+
+		default:
+		{
+			//the sliding pieces.
+			const TileType tile_type{ static_cast<TileType>(piece & 7) };
+
+			const bool diagonal{ tile_type == TileType::Bishop || tile_type == TileType::Queen };
+			const bool straight{ tile_type == TileType::Rook || tile_type == TileType::Queen };
+
+			for (int v{ 0 }; v < 8; ++v) {
+
+				if ((v < 4 && !diagonal) || (v >= 4 && !straight))
+					continue;
+
+				const int vector{ (v < 4) ? bishop_vectors[v] : rook_vectors[v - 4] };
+				int destination{ from + vector };
+
+				while (is_empty(destination)) {
+
+					add(from, destination);
+					destination += vector;
+				}
+
+				if (is_enemy_of<Side>(destination))
+					add(from, destination);
+			}
+			break;
+		}
+		}
+	}
+
+	return count;
+}
+
+template<Chess::Faction Side>
+void Chess::Position::add_pawn_move(Move* moves, int& count, const int from, const int to) const
+{
+	using Traits = FactionTraits<Side>;
+
+	if (get_row(to) != Traits::promotion_row) {
+
+		moves[count++] = Move{ from, to, 0 };
+		return;
+	}
+
+	//one move per promotion piece.
+	for (const char promotion : (Traits::is_white ? white_promotion_notation : black_promotion_notation))
+		moves[count++] = Move{ from, to, promotion };
+}
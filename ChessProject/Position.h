@@ -0,0 +1,101 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This struct serves as a compact, trivially copyable snapshot of a board for 'copy-make' tree walks. It holds a byte per tile of the same 10x12 board the Board
+uses, with the player to move, castling permissions, enpassant tile and clocks, in under 200 bytes. A move is made by copying the position into the next ply's slot
+and changing the copy, so there is nothing to undo: the parent is still intact. Moves are generated pseudo-legally and a move is only kept if the mover's king
+isn't attacked after it is made.
+*/
+
+#ifndef __POSITION_HEADER
+#define __POSITION_HEADER
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "AttackTables.h"
+#include "BoardBase.h"
+#include "FactionTraits.h"
+#include "MoveCommand.h"
+#include "Tile.h"
+
+namespace Chess {
+
+	struct Position
+	{
+		using TileVector = BoardBase<10, 12, Tile>::TileVector;
+		using Squares = BoardBase<10, 12, Tile>::Squares;
+
+		//more than the legal moves of any reachable position.
+		static constexpr int max_moves{ 256 };
+
+		//piece codes, as in the PackedPosition: the TileType, plus 8 for black. border tiles hold TileType::Border.
+		std::array<std::uint8_t, 120> m_tiles{};
+		//indexed by black (1) or white (0).
+		std::array<std::uint8_t, 2> m_king_positions{};
+
+		std::uint8_t m_black_to_play{ 0 };
+		//K = 1, Q = 2, k = 4, q = 8, as in Board::get_castle_permissions.
+		std::uint8_t m_castle_permissions{ 0 };
+		//the tile skipped by the last double push, as FEN gives it, or 0.
+		std::uint8_t m_enpassant_position{ 0 };
+
+		std::uint16_t m_half_move_clock{ 0 };
+		std::uint16_t m_full_move_clock{ 1 };
+
+		static constexpr std::uint8_t black{ 8 };
+		static constexpr std::uint8_t border{ static_cast<std::uint8_t>(TileType::Border) };
+
+		inline const TileType get_tile_type(const int position) const { return static_cast<TileType>(m_tiles[position] & 7); }
+		inline const bool is_empty(const int position) const { return m_tiles[position] == 0; }
+		//an enemy of the player to move, borders and empty tiles are nobody's.
+		inline const bool is_enemy(const int position) const { return !is_empty(position) && (m_tiles[position] != border) && (((m_tiles[position] & black) != 0) != (m_black_to_play != 0)); }
+
+		//write the legal moves into moves, which must hold max_moves, and return how many there are. promotions are one move per promotion piece.
+		const int generate_moves(Move* moves) const;
+		//stop at the first legal move, for telling a mate or stalemate apart from a position that goes on.
+		const bool has_legal_move() const;
+		//the number of legal moves, without keeping them.
+		const int count_moves() const;
+
+		//make a move on this position. copy the position first to keep the parent.
+		void make_move(const Move& move);
+
+		//is the position attacked by the given side?
+		const bool is_attacked(const int position, const bool by_black) const;
+		inline const bool is_in_check() const { return is_attacked(m_king_positions[m_black_to_play], m_black_to_play == 0); }
+
+		//count the leaf nodes of the game tree to a given depth, as Board::perft does.
+		const std::uint64_t perft(const int depth) const;
+
+	private:
+
+		//the side to move is dispatched on once, by the public methods above, then each of these is compiled for one side.
+		template<Faction Side>
+		const int generate_legal_moves(Move* moves, const bool first_only) const;
+		template<Faction Side>
+		const int generate_pseudo_legal_moves(Move* moves) const;
+		template<Faction Side>
+		void add_pawn_move(Move* moves, int& count, const int from, const int to) const;
+
+		template<Faction Side>
+		void make_move(const Move& move);
+		template<Faction Attacker>
+		const bool is_attacked(const int position) const;
+		template<Faction Side>
+		const std::uint64_t perft(const int depth) const;
+
+		//an enemy of the given side. for white that is any black piece code, for black any white piece code, neither matching an empty or border tile.
+		template<Faction Side>
+		inline const bool is_enemy_of(const int position) const { return FactionTraits<Side>::is_white ? (m_tiles[position] > black) : ((m_tiles[position] != 0) && (m_tiles[position] < border)); }
+	};
+
+	static_assert(std::is_trivially_copyable<Position>::value, "Positions must be trivially copyable for copy-make!");
+	static_assert(sizeof(Position) < 200, "Positions must stay small, they are copied every ply!");
+}
+
+#endif
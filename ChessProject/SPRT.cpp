@@ -0,0 +1,82 @@
+#include "SPRT.h"
+
+#include <cmath>
+
+SPRT::SPRT(const double elo0, const double elo1, const double alpha, const double beta)
+	: m_score0(elo_to_score(elo0)), m_score1(elo_to_score(elo1)), m_lower_bound(std::log(beta / (1.0 - alpha))), m_upper_bound(std::log((1.0 - beta) / alpha)) {}
+
+void SPRT::add_result(const int wins, const int draws, const int losses)
+{
+	m_wins += wins;
+	m_draws += draws;
+	m_losses += losses;
+}
+
+const SPRTState SPRT::get_state() const
+{
+	const double llr{ get_llr() };
+
+	if (llr >= m_upper_bound)
+		return SPRTState::AcceptH1;
+	if (llr <= m_lower_bound)
+		return SPRTState::AcceptH0;
+
+	return SPRTState::Continue;
+}
+
+const double SPRT::get_llr() const
+{
+	const double variance{ get_variance() };
+
+	//until both a better and a worse result than the mean have been seen there is no spread to test against.
+	if (variance <= 0.0)
+		return 0.0;
+
+	const double games{ static_cast<double>(get_games()) };
+	return games * (m_score1 - m_score0) * ((2.0 * get_score()) - m_score0 - m_score1) / (2.0 * variance);
+}
+
+const double SPRT::get_elo() const
+{
+	return (get_games() == 0) ? 0.0 : score_to_elo(get_score());
+}
+
+const double SPRT::get_elo_error() const
+{
+	if (get_games() == 0)
+		return 0.0;
+
+	//1.96 standard errors either side of the mean score, converted to Elo.
+	const double error{ 1.96 * std::sqrt(get_variance() / get_games()) };
+	return (score_to_elo(get_score() + error) - score_to_elo(get_score() - error)) / 2.0;
+}
+
+const double SPRT::elo_to_score(const double elo)
+{
+	return 1.0 / (1.0 + std::pow(10.0, -elo / 400.0));
+}
+
+const double SPRT::score_to_elo(const double score)
+{
+	//a score of 0 or 1 is an infinite Elo difference, clamp it to something printable.
+	const double clamped{ std::fmin(std::fmax(score, 1e-6), 1.0 - 1e-6) };
+	return -400.0 * std::log10((1.0 / clamped) - 1.0);
+}
+
+const double SPRT::get_score() const
+{
+	return (m_wins + (0.5 * m_draws)) / get_games();
+}
+
+const double SPRT::get_variance() const
+{
+	if (get_games() == 0)
+		return 0.0;
+
+	const double score{ get_score() };
+	const double win_deviation{ 1.0 - score };
+	const double draw_deviation{ 0.5 - score };
+	const double loss_deviation{ 0.0 - score };
+
+	return ((m_wins * win_deviation * win_deviation) + (m_draws * draw_deviation * draw_deviation) + (m_losses * loss_deviation * loss_deviation)) / get_games();
+}
@@ -0,0 +1,68 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves as a sequential probability ratio test (SPRT) between two Elo hypotheses, H0: elo = elo0 and H1: elo = elo1. After each game the
+log-likelihood ratio of the results is compared against bounds set by the accepted false positive (alpha) and false negative (beta) rates, so a match can stop as
+soon as the result is significant rather than after a fixed number of games. The log-likelihood ratio uses the usual normal approximation of the trinomial
+(win/draw/loss) distribution of game results.
+*/
+
+#ifndef __SPRT_HEADER
+#define __SPRT_HEADER
+
+#include <cstddef>
+
+enum class SPRTState
+{
+	Continue,
+	AcceptH0,
+	AcceptH1
+};
+
+class SPRT
+{
+public:
+	SPRT(const double elo0, const double elo1, const double alpha, const double beta);
+	~SPRT() {}
+
+	//results are from the point of view of the engine being tested.
+	void add_result(const int wins, const int draws, const int losses);
+
+	const SPRTState get_state() const;
+	const double get_llr() const;
+
+	inline const double get_lower_bound() const { return m_lower_bound; }
+	inline const double get_upper_bound() const { return m_upper_bound; }
+
+	//the Elo difference the results so far suggest, and the half width of its 95% confidence interval.
+	const double get_elo() const;
+	const double get_elo_error() const;
+
+	inline const int get_wins() const { return m_wins; }
+	inline const int get_draws() const { return m_draws; }
+	inline const int get_losses() const { return m_losses; }
+	inline const int get_games() const { return m_wins + m_draws + m_losses; }
+
+private:
+
+	//the expected score of an engine with the given Elo advantage.
+	static const double elo_to_score(const double elo);
+	static const double score_to_elo(const double score);
+
+	const double get_score() const;
+	const double get_variance() const;
+
+	double m_score0;
+	double m_score1;
+	double m_lower_bound;
+	double m_upper_bound;
+
+	int m_wins{ 0 };
+	int m_draws{ 0 };
+	int m_losses{ 0 };
+};
+
+#endif
@@ -0,0 +1,389 @@
+#include "Search.h"
+
+#include <algorithm>
+
+const Chess::SearchResult Chess::Search::search(const int depth)
+{
+	SearchLimits limits;
+	limits.m_depth = depth;
+
+	return search(limits);
+}
+
+const Chess::SearchResult Chess::Search::search(const SearchLimits& limits)
+{
+	SearchResult result;
+	m_nodes = 0;
+	m_statistics = SearchStatistics{};
+
+	for (auto& killers : m_killers)
+		killers[0] = killers[1] = Move{};
+
+	{
+		std::lock_guard<std::mutex> lock(m_clock_mutex);
+
+		m_limits = limits;
+		m_start = std::chrono::steady_clock::now();
+		m_last_info = m_start;
+		m_started = true;
+
+		//a pondering search has no deadline until ponderhit, which may have arrived before the search started.
+		if ((m_limits.m_move_time.count() > 0) && (!m_limits.m_ponder || m_ponderhit))
+			m_deadline = (m_start + m_limits.m_move_time).time_since_epoch().count();
+	}
+
+	m_board.generate_legal_moves();
+
+	//the root keeps its own commands, every other node regenerates the member movelist.
+	std::vector<MoveList> moves{ m_board.take_move_list() };
+	std::vector<ChessCommandBase*> root_moves;
+
+	for (auto& movelist : moves) {
+
+		for (auto& command : movelist)
+			root_moves.push_back(command.get());
+	}
+
+	if (root_moves.empty())
+		return result;
+
+	ChessCommandBase* best_root_command{ root_moves.front() };
+	int best_root_variation{ 0 };
+	result.m_best_move = get_move(*best_root_command, 0);
+
+	for (int iteration_depth{ 1 }; iteration_depth <= m_limits.m_depth; ++iteration_depth) {
+
+		int alpha{ -mate_score - 1 };
+		const int beta{ mate_score + 1 };
+
+		ChessCommandBase* best_command{ nullptr };
+		int best_variation{ 0 };
+
+		for (auto command : root_moves) {
+
+			for (int variation{ 0 }; variation < get_variations(*command); ++variation) {
+
+				make(*command, get_promotion(variation));
+				const int score{ -negamax(iteration_depth - 1, 1, -beta, -alpha) };
+				unmake(*command);
+
+				if (m_stopped)
+					break;
+
+				if (score > alpha) {
+
+					alpha = score;
+					best_command = command;
+					best_variation = variation;
+				}
+			}
+
+			if (m_stopped)
+				break;
+		}
+
+		//an interrupted iteration hasn't looked at every move, so its result can't be trusted over the last complete one.
+		if (m_stopped)
+			break;
+
+		best_root_command = best_command;
+		best_root_variation = best_variation;
+
+		result.m_best_move = get_move(*best_command, best_variation);
+		result.m_score = alpha;
+		result.m_depth = iteration_depth;
+
+		send_info(true, iteration_depth, alpha, result.m_best_move);
+
+		//search the best move first next iteration, it gives the tightest bounds.
+		const auto best{ std::find(root_moves.begin(), root_moves.end(), best_command) };
+		std::rotate(root_moves.begin(), best, best + 1);
+
+		//a found mate can't be improved upon by searching deeper.
+		if (is_mate_score(alpha) && (alpha > 0))
+			break;
+
+		//the next iteration takes longer than all of the previous ones, so don't start one that is unlikely to finish.
+		const auto deadline{ m_deadline.load() };
+		if ((deadline != no_deadline) && ((std::chrono::steady_clock::now() + (m_limits.m_move_time / 2)).time_since_epoch().count() > deadline))
+			break;
+	}
+
+	result.m_nodes = m_nodes;
+	result.m_statistics = m_statistics;
+
+	if (m_table != nullptr)
+		result.m_ponder_move = find_ponder_move(*best_root_command, best_root_variation);
+
+	return result;
+}
+
+const std::chrono::milliseconds Chess::SearchLimits::allocate_time(const std::chrono::milliseconds time, const std::chrono::milliseconds increment, const int moves_to_go)
+{
+	const int moves_left{ (moves_to_go > 0) ? moves_to_go : default_moves_to_go };
+	const std::chrono::milliseconds available{ std::max(time - move_overhead, std::chrono::milliseconds(1)) };
+	const std::chrono::milliseconds allocated{ (time / moves_left) + ((increment * 3) / 4) };
+
+	return std::clamp(allocated, std::chrono::milliseconds(1), available);
+}
+
+void Chess::Search::ponderhit()
+{
+	std::lock_guard<std::mutex> lock(m_clock_mutex);
+	m_ponderhit = true;
+
+	//the time spent pondering counts towards the move, so a long ponder on the right move means a fast reply.
+	if (m_started && (m_limits.m_move_time.count() > 0))
+		m_deadline = (m_start + m_limits.m_move_time).time_since_epoch().count();
+}
+
+const int Chess::Search::negamax(const int depth, const int ply, int alpha, int beta)
+{
+	++m_nodes;
+
+	if ((m_nodes % check_interval) == 0)
+		check_limits();
+
+	if (m_stopped)
+		return 0;
+
+	//a position repeated in the tree is scored as a draw, the side ahead would have to deviate so it may as well be one.
+	if (m_board.get_half_move_clock() >= 100 || m_board.is_repetition())
+		return 0;
+
+	//a deep enough result for this position may already be known.
+	const std::uint64_t key{ (m_table != nullptr) ? m_board.get_hash() : 0 };
+	Move hash_move;
+
+	if (m_table != nullptr) {
+
+		if (const TranspositionEntry* entry{ m_table->probe(key) }) {
+
+			hash_move = entry->m_best_move;
+
+			if (entry->m_depth >= depth) {
+
+				const int score{ score_from_table(entry->m_score, ply) };
+
+				if ((entry->m_bound == Bound::Exact)
+					|| ((entry->m_bound == Bound::Lower) && (score >= beta))
+					|| ((entry->m_bound == Bound::Upper) && (score <= alpha)))
+					return score;
+			}
+		}
+	}
+
+	//a leaf with no moves is still a mate or stalemate, but only whether a move exists is needed to score it.
+	if (depth == 0) {
+
+		const BoardState state{ m_board.state() };
+
+		if (state == BoardState::Checkmate)
+			return -mate_score + ply;
+
+		return (state == BoardState::Legal) ? evaluate() : 0;
+	}
+
+	//the hash move, captures and killers are generated and searched before the quiet moves, which a cut-off may never need.
+	MovePicker picker(m_board, hash_move, m_killers[ply][0], m_killers[ply][1]);
+	ChessCommandBase* command{ picker.next() };
+
+	if (command == nullptr)
+		return m_board.get_current_check_state() ? (-mate_score + ply) : 0;
+
+	const int original_alpha{ alpha };
+	Move best_move;
+
+	for (; command != nullptr; command = picker.next()) {
+
+		//a quiet move is one that doesn't change the material, and is a killer if it causes a cut-off.
+		const bool is_quiet{ (m_board[command->get_to()] == TileType::Empty) && !command->is_promotion() };
+
+		for (int variation{ 0 }; variation < get_variations(*command); ++variation) {
+
+			make(*command, get_promotion(variation));
+			const int score{ -negamax(depth - 1, ply + 1, -beta, -alpha) };
+			unmake(*command);
+
+			++m_statistics.m_searched_moves;
+
+			if (m_stopped)
+				return 0;
+
+			if (score >= beta) {
+
+				if (m_table != nullptr)
+					m_table->store(key, depth, score_to_table(beta, ply), Bound::Lower, get_move(*command, variation));
+
+				if (is_quiet && !is_same_move(m_killers[ply][0], *command)) {
+
+					m_killers[ply][1] = m_killers[ply][0];
+					m_killers[ply][0] = get_move(*command, variation);
+				}
+
+				record_generation(picker);
+				return beta;
+			}
+
+			if (score > alpha) {
+
+				alpha = score;
+				best_move = get_move(*command, variation);
+			}
+		}
+	}
+
+	if (m_table != nullptr)
+		m_table->store(key, depth, score_to_table(alpha, ply), (alpha > original_alpha) ? Bound::Exact : Bound::Upper, best_move);
+
+	record_generation(picker);
+	return alpha;
+}
+
+void Chess::Search::record_generation(const MovePicker& picker)
+{
+	m_statistics.m_generated_moves += picker.get_generated_moves();
+	++m_statistics.m_interior_nodes;
+
+	//what generating every move up front would have cost, only worked out when asked for as it's a generation of its own.
+	if (m_limits.m_measure_generation)
+		m_statistics.m_legal_moves += m_board.count_legal_moves();
+}
+
+const int Chess::Search::evaluate() const
+{
+	//indexed by TileType.
+	static const int piece_values[] = { 0, 100, 320, 330, 500, 900, 0, 0 };
+
+	const Faction player{ m_board.get_player_faction() };
+	int score{ 0 };
+
+	for (int position{ 0 }; position < static_cast<int>(m_board.size()); ++position) {
+
+		const Tile& tile{ m_board[position] };
+		const int value{ piece_values[static_cast<int>(tile.getTileType())] };
+
+		score += (tile == player) ? value : -value;
+	}
+
+	return score;
+}
+
+void Chess::Search::make(ChessCommandBase& command, const char promotion)
+{
+	m_board.make_move(command);
+
+	if (m_board.is_promotion())
+		m_board.promote(promotion);
+
+	m_board.rotate_players();
+}
+
+void Chess::Search::unmake(ChessCommandBase& command)
+{
+	m_board.rotate_players();
+	m_board.unmake_move(command);
+}
+
+const char Chess::Search::get_promotion(const int variation) const
+{
+	//queen first, under-promotions are rarely best.
+	static const char white_promotions[] = { 'Q', 'N', 'R', 'B' };
+	static const char black_promotions[] = { 'q', 'n', 'r', 'b' };
+
+	return (m_board.get_player_faction() == Faction::White) ? white_promotions[variation] : black_promotions[variation];
+}
+
+const Chess::Move Chess::Search::get_move(const ChessCommandBase& command, const int variation) const
+{
+	Move move;
+	move.m_from = command.get_from();
+	move.m_to = command.get_to();
+	move.m_promotion = command.is_promotion() ? get_promotion(variation) : 0;
+
+	return move;
+}
+
+void Chess::Search::check_limits()
+{
+	if ((m_limits.m_nodes != 0) && (m_nodes >= m_limits.m_nodes))
+		m_stopped = true;
+
+	const auto now{ std::chrono::steady_clock::now() };
+
+	if (now.time_since_epoch().count() >= m_deadline.load())
+		m_stopped = true;
+
+	if ((now - m_last_info) >= info_interval) {
+
+		m_last_info = now;
+		send_info(false, 0, 0, Move());
+	}
+}
+
+const std::chrono::milliseconds Chess::Search::get_elapsed() const
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start);
+}
+
+void Chess::Search::send_info(const bool iteration_complete, const int depth, const int score, const Move& best_move) const
+{
+	if (!m_info_callback)
+		return;
+
+	SearchInfo info;
+	info.m_iteration_complete = iteration_complete;
+	info.m_depth = depth;
+	info.m_score = score;
+	info.m_best_move = best_move;
+	info.m_nodes = m_nodes;
+	info.m_time = get_elapsed();
+	info.m_hashfull = (m_table != nullptr) ? m_table->get_hashfull() : 0;
+
+	m_info_callback(info);
+}
+
+const Chess::Move Chess::Search::find_ponder_move(ChessCommandBase& best_command, const int variation)
+{
+	Move ponder_move;
+
+	make(best_command, get_promotion(variation));
+
+	const TranspositionEntry* entry{ m_table->probe(m_board.get_hash()) };
+
+	if ((entry != nullptr) && (entry->m_best_move.m_from != 0)) {
+
+		//a hash collision could give a move that isn't legal here, so check it against the real moves.
+		m_board.generate_legal_moves();
+		std::vector<MoveList> moves{ m_board.take_move_list() };
+
+		const Move& hash_move{ entry->m_best_move };
+		const auto movelist{ std::find_if(moves.begin(), moves.end(), [&hash_move](const MoveList& movelist) { return movelist.get_origin() == hash_move.m_from; }) };
+
+		if ((movelist != moves.end()) && (movelist->find_in_list(hash_move.m_to) != movelist->end()))
+			ponder_move = hash_move;
+	}
+
+	unmake(best_command);
+	return ponder_move;
+}
+
+const int Chess::Search::score_to_table(const int score, const int ply)
+{
+	if (score > mate_score - max_mate_ply)
+		return score + ply;
+	if (score < -mate_score + max_mate_ply)
+		return score - ply;
+
+	return score;
+}
+
+const int Chess::Search::score_from_table(const int score, const int ply)
+{
+	if (score > mate_score - max_mate_ply)
+		return score - ply;
+	if (score < -mate_score + max_mate_ply)
+		return score + ply;
+
+	return score;
+}
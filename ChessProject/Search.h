@@ -0,0 +1,169 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to search the game tree of a board for the best move using an iteratively deepened alpha-beta (negamax) search. Positions are scored by material
+only, which is enough to find tactics and mates within the search horizon. The search makes and unmakes moves on the board it is given, so the board is left as it
+was found. A search may be limited by depth, nodes or time, and can be stopped from another thread.
+*/
+
+#ifndef __SEARCH_HEADER
+#define __SEARCH_HEADER
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+
+#include "Board.h"
+#include "MovePicker.h"
+#include "TranspositionTable.h"
+
+namespace Chess {
+
+	struct SearchLimits
+	{
+		int m_depth{ max_depth };
+		//zero means no limit.
+		std::uint64_t m_nodes{ 0 };
+		std::chrono::milliseconds m_move_time{ 0 };
+		//a pondering search ignores its time limit until ponderhit is called.
+		bool m_ponder{ false };
+		//count every interior node's legal moves too, to compare with the moves the staged generation made. slows the search.
+		bool m_measure_generation{ false };
+
+		static constexpr int max_depth{ 64 };
+
+		//time for one move from a player's clock, spread evenly over the moves left and spending most of the increment, as it is given back every move.
+		static const std::chrono::milliseconds allocate_time(const std::chrono::milliseconds time, const std::chrono::milliseconds increment, const int moves_to_go = 0);
+
+		//never leave the last few milliseconds of a clock unused, the move still has to be played.
+		static constexpr std::chrono::milliseconds move_overhead{ 30 };
+		//assumed number of moves left when it isn't known.
+		static constexpr int default_moves_to_go{ 30 };
+	};
+
+	//how much move generation the interior nodes needed, the root isn't counted.
+	struct SearchStatistics
+	{
+		std::uint64_t m_interior_nodes{ 0 };
+		//moves generated and searched, promotions counted once per promotion piece.
+		std::uint64_t m_generated_moves{ 0 };
+		std::uint64_t m_searched_moves{ 0 };
+		//the legal moves of every interior node, what generating them all up front would make. only counted if measured.
+		std::uint64_t m_legal_moves{ 0 };
+	};
+
+	struct SearchResult
+	{
+		Move m_best_move;
+		//the expected reply to the best move, m_from is zero if there isn't one.
+		Move m_ponder_move;
+		//score in centipawns from the point of view of the player to move.
+		int m_score{ 0 };
+		int m_depth{ 0 };
+		std::uint64_t m_nodes{ 0 };
+		SearchStatistics m_statistics;
+	};
+
+	//progress reports, sent after every completed iteration and periodically while searching.
+	struct SearchInfo
+	{
+		//false for the periodic reports, which only have the node count and timing.
+		bool m_iteration_complete{ false };
+		int m_depth{ 0 };
+		int m_score{ 0 };
+		Move m_best_move;
+		std::uint64_t m_nodes{ 0 };
+		std::chrono::milliseconds m_time{ 0 };
+		int m_hashfull{ 0 };
+	};
+
+	class Search
+	{
+	public:
+		Search(Board& board, TranspositionTable* table = nullptr) : m_board(board), m_table(table) {}
+		~Search() {}
+
+		//iteratively deepen to the given depth, the best move of each iteration is searched first in the next.
+		const SearchResult search(const int depth);
+		const SearchResult search(const SearchLimits& limits);
+
+		//safe to call from other threads while searching. a stopped search stays stopped, so use a new Search for the next one.
+		void stop() { m_stopped = true; }
+		//the pondered move was played, start the clock from when pondering began. safe to call from other threads, before or during the search.
+		void ponderhit();
+
+		void set_info_callback(std::function<void(const SearchInfo&)> callback) { m_info_callback = std::move(callback); }
+
+		//scores beyond this are mates, the distance to mate is subtracted so shorter mates score higher.
+		static constexpr int mate_score{ 100000 };
+		static constexpr int max_mate_ply{ 1000 };
+
+		static const bool is_mate_score(const int score) { return (score > mate_score - max_mate_ply) || (score < -mate_score + max_mate_ply); }
+
+	private:
+
+		const int negamax(const int depth, const int ply, int alpha, int beta);
+		const int evaluate() const;
+
+		//make a move for the player to move and pass the turn, choosing the promotion piece if needed.
+		void make(ChessCommandBase& command, const char promotion);
+		void unmake(ChessCommandBase& command);
+
+		//the number of moves a command represents, promotions are one per promotion piece.
+		const int get_variations(const ChessCommandBase& command) const { return command.is_promotion() ? 4 : 1; }
+		const char get_promotion(const int variation) const;
+		const Move get_move(const ChessCommandBase& command, const int variation) const;
+		static const bool is_same_move(const Move& move, const ChessCommandBase& command) { return (move.m_from == command.get_from()) && (move.m_to == command.get_to()); }
+
+		void record_generation(const MovePicker& picker);
+
+		//poll the node and time limits, and send the periodic progress report.
+		void check_limits();
+		const std::chrono::milliseconds get_elapsed() const;
+		void send_info(const bool iteration_complete, const int depth, const int score, const Move& best_move) const;
+
+		//the table's best reply to the best move, if it is legal.
+		const Move find_ponder_move(ChessCommandBase& best_command, const int variation);
+
+		//mate scores are stored relative to the node, not the root, so they stay correct when reached by a different path.
+		static const int score_to_table(const int score, const int ply);
+		static const int score_from_table(const int score, const int ply);
+
+		Board& m_board;
+		TranspositionTable* m_table;
+		std::uint64_t m_nodes{ 0 };
+		SearchStatistics m_statistics;
+
+		//two quiet moves per ply that caused a cut-off, tried early at the same ply elsewhere in the tree as they often cut it off again.
+		std::array<std::array<Move, 2>, SearchLimits::max_depth + 1> m_killers{};
+
+		SearchLimits m_limits;
+		std::function<void(const SearchInfo&)> m_info_callback;
+
+		std::atomic<bool> m_stopped{ false };
+
+		//the limits and start time are shared with ponderhit, which may be called from another thread.
+		std::mutex m_clock_mutex;
+		bool m_started{ false };
+		bool m_ponderhit{ false };
+
+		//times are steady_clock ticks, so ponderhit can move the deadline while the search reads it.
+		std::chrono::steady_clock::time_point m_start;
+		std::atomic<std::chrono::steady_clock::rep> m_deadline{ no_deadline };
+		std::chrono::steady_clock::time_point m_last_info;
+
+		static constexpr std::chrono::steady_clock::rep no_deadline{ std::numeric_limits<std::chrono::steady_clock::rep>::max() };
+		//how often the limits are polled, and the progress reported.
+		static constexpr std::uint64_t check_interval{ 1024 };
+		static constexpr std::chrono::milliseconds info_interval{ 1000 };
+	};
+}
+
+#endif
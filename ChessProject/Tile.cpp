@@ -2,6 +2,37 @@
 #include <ostream>
 
 namespace Chess {
+
+	const char Tile::get_notation() const
+	{
+		//indexed by TileType, white pieces are the upper case half of the table.
+		static const char white_notation[] = { ' ', 'P', 'N', 'B', 'R', 'Q', 'K', '#' };
+		static const char black_notation[] = { ' ', 'p', 'n', 'b', 'r', 'q', 'k', '#' };
+
+		const int index{ static_cast<int>(getTileType()) };
+		return (*this == Faction::Black) ? black_notation[index] : white_notation[index];
+	}
+
+	const Tile Tile::from_notation(const char notation)
+	{
+		switch (notation)
+		{
+		case 'P': return Tile(TileType::Pawn, Faction::White);
+		case 'N': return Tile(TileType::Knight, Faction::White);
+		case 'B': return Tile(TileType::Bishop, Faction::White);
+		case 'R': return Tile(TileType::Rook, Faction::White);
+		case 'Q': return Tile(TileType::Queen, Faction::White);
+		case 'K': return Tile(TileType::King, Faction::White);
+		case 'p': return Tile(TileType::Pawn, Faction::Black);
+		case 'n': return Tile(TileType::Knight, Faction::Black);
+		case 'b': return Tile(TileType::Bishop, Faction::Black);
+		case 'r': return Tile(TileType::Rook, Faction::Black);
+		case 'q': return Tile(TileType::Queen, Faction::Black);
+		case 'k': return Tile(TileType::King, Faction::Black);
+		default: return Tile();
+		}
+	}
+
 	std::ostream& operator<<(std::ostream& os, const Tile& tile)
 	{
 		switch (tile.getTileType())
@@ -15,6 +15,7 @@ a chess board.
 #include "TileBase.h"
 
 #include <ostream>
+#include <type_traits>
 
 namespace Chess
 {
@@ -43,13 +44,20 @@ namespace Chess
 	{
 	public:
 
-		Tile(const TileType tiletype, const Faction faction) : TileBase<TileType, Faction>(tiletype, faction) {}
-		Tile() : Tile(TileType::Empty, Faction::NonAligned) {}
-		~Tile() {}
+		constexpr Tile(const TileType tiletype, const Faction faction) : TileBase<TileType, Faction>(tiletype, faction) {}
+		constexpr Tile() : Tile(TileType::Empty, Faction::NonAligned) {}
 
-		void clear() { m_faction = Faction::NonAligned; m_tiletype = TileType::Empty; }
+		void clear() { m_code = encode(TileType::Empty, Faction::NonAligned); }
+
+		//the FEN charachter of the tile, upper case for white and lower case for black. Empty and border tiles have no notation.
+		const char get_notation() const;
+		//the tile of a piece's FEN charachter, an empty tile if the charachter isn't a piece.
+		static const Tile from_notation(const char notation);
 
 		friend std::ostream& operator<<(std::ostream& os, const Tile& tile);
 	};
+
+	static_assert(sizeof(Tile) == 1, "Tiles must pack into a byte!");
+	static_assert(std::is_trivially_copyable<Tile>::value, "Tiles must be trivially copyable, so a board copies as one block!");
 }
 #endif
\ No newline at end of file
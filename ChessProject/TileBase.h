@@ -4,34 +4,40 @@ Author: Christopher Ryder
 Email: Christopher.Ryder-2@student.manchester.ac.uk
 
 Remit:
-This class serves as a general implementation of a game-board tile.
+This class serves as a general implementation of a game-board tile. The tile type and faction are packed into a single byte, the type in the low bits and the
+faction above it, so a tile is trivially copyable and a board of them copies as one block of memory. Comparing a tile against a type or a faction is a mask.
 */
 
 #ifndef __TILEBASE_HEADER
 #define __TILEBASE_HEADER
 
-//Template class, takes a tile type and a faction.
-template<class TileTypeEnum, class FactionEnum>
+#include <cstdint>
+
+//Template class, takes a tile type and a faction, and the number of bits the tile types need.
+template<class TileTypeEnum, class FactionEnum, int TypeBits = 3>
 class TileBase
 {
 public:
 
-	TileBase(const TileTypeEnum& tiletype, const FactionEnum& faction) : m_tiletype(tiletype), m_faction(faction) {}
-	virtual ~TileBase() = 0;
+	constexpr TileBase(const TileTypeEnum& tiletype, const FactionEnum& faction) : m_code(encode(tiletype, faction)) {}
+
+	inline constexpr const bool operator==(const TileTypeEnum type) const { return((m_code & type_mask) == static_cast<std::uint8_t>(type)); }
+	inline constexpr const bool operator==(const FactionEnum faction) const { return((m_code >> TypeBits) == static_cast<std::uint8_t>(faction)); }
+	inline constexpr const bool operator!=(const TileTypeEnum type) const { return !(*this == type); }
+	inline constexpr const bool operator!=(const FactionEnum faction) const { return !(*this == faction); }
+
+	inline constexpr const TileTypeEnum getTileType() const { return static_cast<TileTypeEnum>(m_code & type_mask); }
+	inline constexpr const FactionEnum getFaction() const { return static_cast<FactionEnum>(m_code >> TypeBits); }
 
-	inline const bool operator==(const TileTypeEnum type) const { return(m_tiletype == type); }
-	inline const bool operator==(const FactionEnum faction) const { return(m_faction == faction); }
-	inline const bool operator!=(const TileTypeEnum type) const { return(m_tiletype != type); }
-	inline const bool operator!=(const FactionEnum faction) const { return(m_faction != faction); }
+	//the packed tile, for comparing a whole tile, type and faction, at once.
+	inline constexpr const std::uint8_t get_code() const { return m_code; }
 
-	inline const TileTypeEnum getTileType() const { return m_tiletype; }
-	inline const FactionEnum getFaction() const { return m_faction; }
+	static constexpr std::uint8_t encode(const TileTypeEnum tiletype, const FactionEnum faction) { return static_cast<std::uint8_t>(static_cast<int>(tiletype) | (static_cast<int>(faction) << TypeBits)); }
 
 protected:
-	TileTypeEnum m_tiletype;
-	FactionEnum m_faction;
-};
 
-template<class TileTypeEnum, class FactionEnum>
-inline TileBase<TileTypeEnum, FactionEnum>::~TileBase() = default;
-#endif
\ No newline at end of file
+	static constexpr std::uint8_t type_mask{ (1 << TypeBits) - 1 };
+
+	std::uint8_t m_code;
+};
+#endif
@@ -0,0 +1,57 @@
+#include "TranspositionTable.h"
+
+#include <algorithm>
+
+Chess::TranspositionTable::TranspositionTable(const std::size_t megabytes)
+{
+	resize(megabytes);
+}
+
+void Chess::TranspositionTable::resize(const std::size_t megabytes)
+{
+	const std::size_t bytes{ std::clamp<std::size_t>(megabytes, 1, max_megabytes) * 1024 * 1024 };
+
+	//a power of two number of entries lets the key be masked instead of divided.
+	std::size_t entries{ 1 };
+	while ((entries * 2) * sizeof(TranspositionEntry) <= bytes)
+		entries *= 2;
+
+	m_entries.assign(entries, TranspositionEntry());
+	m_mask = entries - 1;
+}
+
+void Chess::TranspositionTable::clear()
+{
+	std::fill(m_entries.begin(), m_entries.end(), TranspositionEntry());
+}
+
+const Chess::TranspositionEntry* Chess::TranspositionTable::probe(const std::uint64_t key) const
+{
+	const TranspositionEntry& entry{ m_entries[key & m_mask] };
+	return ((entry.m_bound != Bound::None) && (entry.m_key == key)) ? &entry : nullptr;
+}
+
+void Chess::TranspositionTable::store(const std::uint64_t key, const int depth, const int score, const Bound bound, const Move& best_move)
+{
+	TranspositionEntry& entry{ m_entries[key & m_mask] };
+
+	if ((entry.m_key == key) && (entry.m_depth > depth))
+		return;
+
+	//keep the old best move if this search of the position didn't find one, it is still the best guess.
+	if ((best_move.m_from != 0) || (entry.m_key != key))
+		entry.m_best_move = best_move;
+
+	entry.m_key = key;
+	entry.m_depth = depth;
+	entry.m_score = score;
+	entry.m_bound = bound;
+}
+
+const int Chess::TranspositionTable::get_hashfull() const
+{
+	const std::size_t sample{ std::min<std::size_t>(1000, m_entries.size()) };
+	const auto used{ std::count_if(m_entries.begin(), m_entries.begin() + sample, [](const TranspositionEntry& entry) { return entry.m_bound != Bound::None; }) };
+
+	return static_cast<int>((used * 1000) / sample);
+}
@@ -0,0 +1,68 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves as a fixed-size hash table of search results, keyed by the Zobrist hash of a position. The search stores the score, depth, bound and best move
+of every node it finishes, and probes the table before searching a node so positions reached by different move orders are only searched once.
+*/
+
+#ifndef __TRANSPOSITIONTABLE_HEADER
+#define __TRANSPOSITIONTABLE_HEADER
+
+#include <cstdint>
+#include <vector>
+
+#include "MoveCommand.h"
+
+namespace Chess {
+
+	//how the stored score relates to the true score of the position.
+	enum class Bound : std::uint8_t
+	{
+		None,
+		Exact,
+		Lower,
+		Upper
+	};
+
+	struct TranspositionEntry
+	{
+		std::uint64_t m_key{ 0 };
+		Move m_best_move;
+		int m_score{ 0 };
+		int m_depth{ 0 };
+		Bound m_bound{ Bound::None };
+	};
+
+	class TranspositionTable
+	{
+	public:
+		TranspositionTable(const std::size_t megabytes = default_megabytes);
+		~TranspositionTable() {}
+
+		static constexpr std::size_t default_megabytes{ 16 };
+		static constexpr std::size_t max_megabytes{ 1024 };
+
+		//the table is rounded down to a power of two entries, the contents are discarded.
+		void resize(const std::size_t megabytes);
+		void clear();
+
+		//nullptr if the position isn't in the table.
+		const TranspositionEntry* probe(const std::uint64_t key) const;
+
+		//deeper results replace shallower ones for the same position, a different position always replaces the entry.
+		void store(const std::uint64_t key, const int depth, const int score, const Bound bound, const Move& best_move);
+
+		//the number of used entries per thousand, estimated from the start of the table.
+		const int get_hashfull() const;
+
+	private:
+
+		std::vector<TranspositionEntry> m_entries;
+		std::size_t m_mask{ 0 };
+	};
+}
+
+#endif
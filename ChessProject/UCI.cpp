@@ -0,0 +1,351 @@
+#include "UCI.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "FEN.h"
+
+Chess::UCI::UCI(std::istream& input, std::ostream& output) : m_input(input), m_output(output), m_board(std::make_unique<Board>(FEN(FEN::standard_position))) {}
+
+Chess::UCI::~UCI()
+{
+	finish_search();
+}
+
+void Chess::UCI::run()
+{
+	std::string command_input;
+
+	while (std::getline(m_input, command_input)) {
+
+		//GUIs on Windows may send carriage returns.
+		if (!command_input.empty() && command_input.back() == '\r')
+			command_input.pop_back();
+
+		if (!dispatch_command(command_input))
+			break;
+	}
+
+	finish_search();
+}
+
+const std::pair<bool, Chess::Move> Chess::UCI::parse_move(const Board& board, const std::string& notation)
+{
+	Move move;
+
+	if (notation.length() != 4 && notation.length() != 5)
+		return std::pair<bool, Move>(false, move);
+
+	const auto from = board.convert_coordinate_to_position(std::string_view(notation).substr(0, 2));
+	const auto to = board.convert_coordinate_to_position(std::string_view(notation).substr(2, 2));
+
+	if (!from.first || !to.first)
+		return std::pair<bool, Move>(false, move);
+
+	move.m_from = from.second;
+	move.m_to = to.second;
+
+	//UCI promotions are always lower case, the board uses the case of the piece's faction.
+	if (notation.length() == 5) {
+
+		const char promotion{ static_cast<char>(std::tolower(static_cast<unsigned char>(notation[4]))) };
+
+		if (std::string("nbrq").find(promotion) == std::string::npos)
+			return std::pair<bool, Move>(false, move);
+
+		move.m_promotion = (board.get_player_faction() == Faction::White) ? static_cast<char>(std::toupper(static_cast<unsigned char>(promotion))) : promotion;
+	}
+
+	return std::pair<bool, Move>(true, move);
+}
+
+bool Chess::UCI::dispatch_command(const std::string& command_input)
+{
+	std::istringstream arguments(command_input);
+	std::string command;
+	arguments >> command;
+
+	if (command == "uci")
+		identify();
+	else if (command == "isready")
+		send("readyok");
+	else if (command == "setoption")
+		set_option(arguments);
+	else if (command == "ucinewgame") {
+
+		finish_search();
+		m_table.clear();
+	}
+	else if (command == "position")
+		set_position(arguments);
+	else if (command == "go")
+		go(arguments);
+	else if (command == "stop")
+		stop();
+	else if (command == "ponderhit")
+		ponderhit();
+	else if (command == "quit") {
+
+		finish_search();
+		return false;
+	}
+	//unknown commands, and 'debug'/'register', are ignored as the protocol asks.
+
+	return true;
+}
+
+void Chess::UCI::identify()
+{
+	send("id name ChessProject");
+	send("id author Christopher Ryder");
+	send("option name Hash type spin default " + std::to_string(TranspositionTable::default_megabytes) + " min 1 max " + std::to_string(TranspositionTable::max_megabytes));
+	send("option name Clear Hash type button");
+	send("option name Ponder type check default false");
+	send("uciok");
+}
+
+void Chess::UCI::set_option(std::istringstream& arguments)
+{
+	//setoption name <name, may contain spaces> [value <value>]
+	std::string token;
+	std::string name;
+	std::string value;
+
+	arguments >> token;
+
+	while (arguments >> token && token != "value")
+		name += (name.empty() ? "" : " ") + token;
+
+	std::getline(arguments >> std::ws, value);
+
+	//the table can't be changed under a running search.
+	if (name == "Hash") {
+
+		finish_search();
+
+		try {
+			m_table.resize(static_cast<std::size_t>(std::stoul(value)));
+		}
+		catch (std::exception&) {
+			send("info string invalid Hash value '" + value + "'");
+		}
+	}
+	else if (name == "Clear Hash") {
+
+		finish_search();
+		m_table.clear();
+	}
+	else if (name != "Ponder") {
+
+		send("info string unknown option '" + name + "'");
+	}
+}
+
+void Chess::UCI::set_position(std::istringstream& arguments)
+{
+	//position [fen <fen> | startpos] [moves <move1> ... <movei>]
+	finish_search();
+
+	std::string token;
+	arguments >> token;
+
+	std::string fen;
+
+	if (token == "startpos") {
+
+		fen = FEN::standard_position;
+		arguments >> token;
+	}
+	else if (token == "fen") {
+
+		while (arguments >> token && token != "moves")
+			fen += (fen.empty() ? "" : " ") + token;
+	}
+	else {
+
+		send("info string invalid position command");
+		return;
+	}
+
+	try {
+		m_board = std::make_unique<Board>(FEN(fen));
+	}
+	catch (std::exception& e) {
+
+		send(std::string("info string invalid position: ") + e.what());
+		m_board = std::make_unique<Board>(FEN(FEN::standard_position));
+		return;
+	}
+
+	if (token != "moves")
+		return;
+
+	//the moves are replayed without generating the movelist at every ply, the search builds its own.
+	while (arguments >> token) {
+
+		const auto move = parse_move(*m_board, token);
+
+		if (!move.first || !m_board->replay_move(move.second)) {
+
+			send("info string illegal move '" + token + "'");
+			return;
+		}
+	}
+}
+
+void Chess::UCI::go(std::istringstream& arguments)
+{
+	finish_search();
+
+	SearchLimits limits;
+	bool infinite{ false };
+
+	int white_time{ -1 };
+	int black_time{ -1 };
+	int white_increment{ 0 };
+	int black_increment{ 0 };
+	int moves_to_go{ 0 };
+	int move_time{ 0 };
+
+	std::string token;
+
+	while (arguments >> token) {
+
+		if (token == "depth")
+			arguments >> limits.m_depth;
+		else if (token == "nodes")
+			arguments >> limits.m_nodes;
+		else if (token == "movetime")
+			arguments >> move_time;
+		else if (token == "wtime")
+			arguments >> white_time;
+		else if (token == "btime")
+			arguments >> black_time;
+		else if (token == "winc")
+			arguments >> white_increment;
+		else if (token == "binc")
+			arguments >> black_increment;
+		else if (token == "movestogo")
+			arguments >> moves_to_go;
+		else if (token == "infinite")
+			infinite = true;
+		else if (token == "ponder")
+			limits.m_ponder = true;
+	}
+
+	limits.m_depth = std::clamp(limits.m_depth, 1, SearchLimits::max_depth);
+
+	const bool white_to_play{ m_board->get_player_faction() == Faction::White };
+	const int time{ white_to_play ? white_time : black_time };
+	const int increment{ white_to_play ? white_increment : black_increment };
+
+	if (move_time > 0)
+		limits.m_move_time = std::max(std::chrono::milliseconds(move_time) - SearchLimits::move_overhead, std::chrono::milliseconds(1));
+	else if (time >= 0 && !infinite)
+		limits.m_move_time = SearchLimits::allocate_time(std::chrono::milliseconds(time), std::chrono::milliseconds(increment), moves_to_go);
+
+	{
+		std::lock_guard<std::mutex> lock(m_search_mutex);
+		m_hold_bestmove = infinite || limits.m_ponder;
+	}
+
+	m_search = std::make_unique<Search>(*m_board, &m_table);
+	m_search->set_info_callback([this](const SearchInfo& info) { send_info(info); });
+
+	m_search_thread = std::thread([this, limits]() {
+
+		const SearchResult result{ m_search->search(limits) };
+
+		//the protocol doesn't allow a bestmove before 'stop' or 'ponderhit' in these modes, however quickly the search finishes.
+		{
+			std::unique_lock<std::mutex> lock(m_search_mutex);
+			m_search_released.wait(lock, [this]() { return !m_hold_bestmove; });
+		}
+
+		if (result.m_best_move.m_from == 0) {
+
+			send("bestmove 0000");
+			return;
+		}
+
+		std::string bestmove{ "bestmove " + m_board->convert_move_to_notation(result.m_best_move) };
+
+		if (result.m_ponder_move.m_from != 0)
+			bestmove += " ponder " + m_board->convert_move_to_notation(result.m_ponder_move);
+
+		send(bestmove);
+	});
+}
+
+void Chess::UCI::stop()
+{
+	if (m_search)
+		m_search->stop();
+
+	{
+		std::lock_guard<std::mutex> lock(m_search_mutex);
+		m_hold_bestmove = false;
+	}
+
+	m_search_released.notify_all();
+}
+
+void Chess::UCI::ponderhit()
+{
+	if (m_search)
+		m_search->ponderhit();
+
+	{
+		std::lock_guard<std::mutex> lock(m_search_mutex);
+		m_hold_bestmove = false;
+	}
+
+	m_search_released.notify_all();
+}
+
+void Chess::UCI::finish_search()
+{
+	if (!m_search_thread.joinable())
+		return;
+
+	stop();
+	m_search_thread.join();
+	m_search.reset();
+}
+
+void Chess::UCI::send(const std::string& message)
+{
+	std::lock_guard<std::mutex> lock(m_output_mutex);
+	m_output << message << std::endl;
+}
+
+void Chess::UCI::send_info(const SearchInfo& info)
+{
+	const long long milliseconds{ static_cast<long long>(info.m_time.count()) };
+	const unsigned long long nodes_per_second{ (info.m_nodes * 1000) / static_cast<unsigned long long>(std::max(milliseconds, 1LL)) };
+
+	std::string message{ "info" };
+
+	if (info.m_iteration_complete)
+		message += " depth " + std::to_string(info.m_depth) + " score " + format_score(info.m_score);
+
+	message += " nodes " + std::to_string(info.m_nodes)
+		+ " nps " + std::to_string(nodes_per_second)
+		+ " hashfull " + std::to_string(info.m_hashfull)
+		+ " time " + std::to_string(milliseconds);
+
+	if (info.m_iteration_complete)
+		message += " pv " + m_board->convert_move_to_notation(info.m_best_move);
+
+	send(message);
+}
+
+const std::string Chess::UCI::format_score(const int score) const
+{
+	if (!Search::is_mate_score(score))
+		return "cp " + std::to_string(score);
+
+	//mate scores count plies to the mate, UCI counts moves.
+	const int plies{ Search::mate_score - std::abs(score) };
+	return "mate " + std::to_string((score > 0) ? ((plies + 1) / 2) : -(plies / 2));
+}
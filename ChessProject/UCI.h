@@ -0,0 +1,79 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves as a Universal Chess Interface (UCI) front-end, so the engine can be driven by chess GUIs and match managers. Commands are read on the calling
+thread while the search runs on a worker thread, so 'stop' and 'isready' are answered straight away during a search. Output from both threads goes through one
+locked writer so lines are never interleaved.
+
+See: https://www.shredderchess.com/chess-features/uci-universal-chess-interface.html
+*/
+
+#ifndef __UCI_HEADER
+#define __UCI_HEADER
+
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "Board.h"
+#include "Search.h"
+#include "TranspositionTable.h"
+
+namespace Chess {
+
+	class UCI
+	{
+	public:
+		UCI(std::istream& input, std::ostream& output);
+		~UCI();
+
+		//read and answer commands until 'quit' or the end of the input.
+		void run();
+
+		//parse a move in UCI long algebraic notation, e.g 'e2e4' or 'e7e8q', for the player to move.
+		static const std::pair<bool, Move> parse_move(const Board& board, const std::string& notation);
+
+	private:
+
+		//false once the engine should exit.
+		bool dispatch_command(const std::string& command_input);
+
+		void identify();
+		void set_option(std::istringstream& arguments);
+		void set_position(std::istringstream& arguments);
+		void go(std::istringstream& arguments);
+		void stop();
+		void ponderhit();
+
+		//stop any search in progress and wait for its bestmove, the board and table are then safe to touch.
+		void finish_search();
+
+		void send(const std::string& message);
+		void send_info(const SearchInfo& info);
+		const std::string format_score(const int score) const;
+
+		std::istream& m_input;
+		std::ostream& m_output;
+		std::mutex m_output_mutex;
+
+		std::unique_ptr<Board> m_board;
+		TranspositionTable m_table;
+
+		std::unique_ptr<Search> m_search;
+		std::thread m_search_thread;
+
+		//infinite and pondering searches hold their bestmove until 'stop' or 'ponderhit'.
+		std::mutex m_search_mutex;
+		std::condition_variable m_search_released;
+		bool m_hold_bestmove{ false };
+	};
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include "VariationTree.h"
+
+#include <algorithm>
+
+Chess::VariationTree::VariationTree(const FEN& fen) : m_board(fen), m_nodes(1) {}
+
+const bool Chess::VariationTree::play(const Move& move)
+{
+	//a move already in the tree was legal when it was added.
+	const NodeIndex existing{ find_child(m_current, move) };
+
+	if (existing != no_node) {
+
+		m_board.replay_move(move, true);
+		m_current = existing;
+		return true;
+	}
+
+	if (!m_board.replay_move(move))
+		return false;
+
+	//the move as the board played it, a promotion without a piece was a queen and may already be in the tree as one.
+	const Move played{ m_board.get_last_move() };
+	const NodeIndex child{ find_child(m_current, played) };
+
+	if (child != no_node) {
+
+		m_current = child;
+		return true;
+	}
+
+	//the new node goes in front of its siblings.
+	Node node;
+	node.m_from = static_cast<std::uint8_t>(played.m_from);
+	node.m_to = static_cast<std::uint8_t>(played.m_to);
+	node.m_promotion = played.m_promotion;
+	node.m_depth = m_nodes[m_current].m_depth + 1;
+	node.m_parent = m_current;
+	node.m_next_sibling = m_nodes[m_current].m_first_child;
+
+	m_nodes[m_current].m_first_child = static_cast<NodeIndex>(m_nodes.size());
+	m_current = m_nodes[m_current].m_first_child;
+	m_nodes.push_back(node);
+
+	return true;
+}
+
+void Chess::VariationTree::jump(const NodeIndex node)
+{
+	//find the deepest node both lines pass through, the target's moves below it are collected on the way.
+	std::vector<Move> moves;
+	NodeIndex from{ m_current };
+	NodeIndex to{ node };
+
+	while (m_nodes[from].m_depth > m_nodes[to].m_depth) {
+
+		m_board.undo_replay_move();
+		from = m_nodes[from].m_parent;
+	}
+
+	while (m_nodes[to].m_depth > m_nodes[from].m_depth) {
+
+		moves.push_back(get_move(to));
+		to = m_nodes[to].m_parent;
+	}
+
+	while (from != to) {
+
+		m_board.undo_replay_move();
+		from = m_nodes[from].m_parent;
+
+		moves.push_back(get_move(to));
+		to = m_nodes[to].m_parent;
+	}
+
+	//the moves were collected from the target up, so they are replayed in reverse.
+	std::reverse(moves.begin(), moves.end());
+	m_board.replay(moves, true);
+
+	m_current = node;
+}
+
+const bool Chess::VariationTree::back()
+{
+	if (m_current == root)
+		return false;
+
+	m_board.undo_replay_move();
+	m_current = m_nodes[m_current].m_parent;
+
+	return true;
+}
+
+const Chess::Move Chess::VariationTree::get_move(const NodeIndex node) const
+{
+	return Move{ m_nodes[node].m_from, m_nodes[node].m_to, m_nodes[node].m_promotion };
+}
+
+const std::vector<Chess::Move> Chess::VariationTree::get_line(const NodeIndex node) const
+{
+	std::vector<Move> line(m_nodes[node].m_depth);
+
+	for (NodeIndex current{ node }; current != root; current = m_nodes[current].m_parent)
+		line[m_nodes[current].m_depth - 1] = get_move(current);
+
+	return line;
+}
+
+const Chess::VariationTree::NodeIndex Chess::VariationTree::find_child(const NodeIndex node, const Move& move) const
+{
+	for (NodeIndex child{ m_nodes[node].m_first_child }; child != no_node; child = m_nodes[child].m_next_sibling) {
+
+		if (m_nodes[child].m_from == move.m_from && m_nodes[child].m_to == move.m_to && m_nodes[child].m_promotion == move.m_promotion)
+			return child;
+	}
+
+	return no_node;
+}
@@ -0,0 +1,85 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This class serves to keep every line explored from a position, rather than the single line of moves a board can undo. Each move is a small node holding the move
+and links to its parent, its first child and its next sibling, so lines that share a beginning share its nodes and the tree only grows by the moves that are new.
+One board follows the tree, and moving it to another node takes back the moves down to the deepest node the two lines share and replays the rest, the moves of
+the shared beginning are never touched.
+*/
+
+#ifndef __VARIATIONTREE_HEADER
+#define __VARIATIONTREE_HEADER
+
+#include <cstdint>
+#include <vector>
+
+#include "Board.h"
+#include "FEN.h"
+
+namespace Chess {
+
+	class VariationTree
+	{
+	public:
+
+		//nodes are referred to by their index, which never changes. the root is the starting position and has no move.
+		using NodeIndex = std::uint32_t;
+		static constexpr NodeIndex root{ 0 };
+		static constexpr NodeIndex no_node{ ~NodeIndex(0) };
+
+		VariationTree(const FEN& fen);
+		~VariationTree() {}
+
+		//the board at the current node.
+		const Board& get_board() const { return m_board; }
+		inline const NodeIndex get_current() const { return m_current; }
+
+		//play a move from the current node and move to the node it reaches. a move played from here before is followed to the node it made, otherwise it
+		//is checked with is_legal and a new node is made. returns false, having moved nowhere, if the move is illegal.
+		const bool play(const Move& move);
+		//move the board to any node, taking back and replaying only the moves the two lines don't share.
+		void jump(const NodeIndex node);
+		//move to the current node's parent, returns false at the root.
+		const bool back();
+
+		//the move which reaches the node, and the nodes around it. a missing node is no_node.
+		const Move get_move(const NodeIndex node) const;
+		inline const NodeIndex get_parent(const NodeIndex node) const { return m_nodes[node].m_parent; }
+		inline const NodeIndex get_first_child(const NodeIndex node) const { return m_nodes[node].m_first_child; }
+		inline const NodeIndex get_next_sibling(const NodeIndex node) const { return m_nodes[node].m_next_sibling; }
+		inline const int get_depth(const NodeIndex node) const { return static_cast<int>(m_nodes[node].m_depth); }
+
+		//the moves from the starting position to the node.
+		const std::vector<Move> get_line(const NodeIndex node) const;
+
+		//the number of nodes, the root and one per distinct move.
+		inline const std::size_t size() const { return m_nodes.size(); }
+
+	private:
+
+		//the positions of a move fit a byte each, the internal board has 120 tiles.
+		struct Node
+		{
+			std::uint8_t m_from{ 0 };
+			std::uint8_t m_to{ 0 };
+			char m_promotion{ 0 };
+
+			std::uint32_t m_depth{ 0 };
+			NodeIndex m_parent{ no_node };
+			NodeIndex m_first_child{ no_node };
+			NodeIndex m_next_sibling{ no_node };
+		};
+
+		//the child of the node reached by the move, or no_node if it hasn't been played from there.
+		const NodeIndex find_child(const NodeIndex node, const Move& move) const;
+
+		Board m_board;
+		std::vector<Node> m_nodes;
+		NodeIndex m_current{ root };
+	};
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+Date: 19/10/2026
+Author: Christopher Ryder
+Email: Christopher.Ryder-2@student.manchester.ac.uk
+
+Remit:
+This file holds the Zobrist keys used to hash a board position into 64 bits. A position's hash is the exclusive-or of a key for every piece on its tile, the
+castling permissions, the enpassant tile and the player to move. The keys are generated at compile time from a fixed seed, so hashes are the same every run.
+*/
+
+#ifndef __ZOBRIST_HEADER
+#define __ZOBRIST_HEADER
+
+#include <cstdint>
+
+#include "Tile.h"
+
+namespace Chess {
+
+	struct ZobristKeys
+	{
+		//indexed by piece code (TileType, plus 8 for black) and internal board position.
+		std::uint64_t m_pieces[16][120]{};
+		//indexed by the castle permission mask (K = 1, Q = 2, k = 4, q = 8).
+		std::uint64_t m_castle_permissions[16]{};
+		//indexed by the position of the pawn which may be captured enpassant.
+		std::uint64_t m_enpassant[120]{};
+		std::uint64_t m_black_to_play{ 0 };
+	};
+
+	//splitmix64, a small generator with good enough statistics for hashing.
+	constexpr std::uint64_t next_zobrist_key(std::uint64_t& state)
+	{
+		std::uint64_t key{ (state += 0x9E3779B97F4A7C15ull) };
+		key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ull;
+		key = (key ^ (key >> 27)) * 0x94D049BB133111EBull;
+		return key ^ (key >> 31);
+	}
+
+	constexpr ZobristKeys generate_zobrist_keys()
+	{
+		ZobristKeys keys{};
+		std::uint64_t state{ 0x5EED5EED5EED5EEDull };
+
+		for (auto& piece_keys : keys.m_pieces)
+			for (auto& key : piece_keys)
+				key = next_zobrist_key(state);
+
+		for (auto& key : keys.m_castle_permissions)
+			key = next_zobrist_key(state);
+
+		for (auto& key : keys.m_enpassant)
+			key = next_zobrist_key(state);
+
+		keys.m_black_to_play = next_zobrist_key(state);
+		return keys;
+	}
+
+	inline constexpr ZobristKeys zobrist_keys{ generate_zobrist_keys() };
+
+	//the piece code of an occupied tile, as used to index the piece keys.
+	inline const int get_zobrist_piece_index(const Tile& tile) { return static_cast<int>(tile.getTileType()) + ((tile == Faction::Black) ? 8 : 0); }
+}
+
+#endif